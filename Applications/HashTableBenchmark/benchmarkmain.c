@@ -0,0 +1,260 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "flathashtable.h"
+#include "hashtable.h"
+#include "listelementspool.h"
+
+#define DEFAULT_ENTRIES_COUNT 200000
+#define KEY_SIZE 32
+#define LOOKUP_ROUNDS 5
+#define LOOKUP_BATCH_SIZE 32
+
+/* Compares the chained HashTable (with and without elements pool) to the open addressing FlatHashTable
+   - usage: HashTableBenchmark [entries count]
+   - the timed operations are: inserting all entries, looking up all keys (multiple rounds), looking up missing keys
+   and erasing all entries
+   - for the chained HashTable the keys are also looked up in batches (getHashEntryValues()), to be compared to the
+   individual lookups
+*/
+
+typedef struct
+{
+    double insertTime;
+    double lookupTime;
+    double batchedLookupTime; // 0 if not applicable
+    double missingLookupTime;
+    double eraseTime;
+} BenchmarkResults;
+
+static double getCurrentTime();
+static char* createKeys(size_t entriesCount, const char* prefix);
+static bool benchmarkHashTable(const char* keys, const char* missingKeys, size_t entriesCount, void* elementsPool,
+                               BenchmarkResults* results);
+static double benchmarkBatchedLookup(const char* keys, size_t entriesCount, HashTable* hashTable,
+                                     size_t* foundEntriesCount);
+static bool benchmarkFlatHashTable(const char* keys, const char* missingKeys, size_t entriesCount,
+                                   BenchmarkResults* results);
+static void printResults(const char* tableType, const BenchmarkResults* results, size_t entriesCount);
+
+int main(int argc, char* argv[])
+{
+    const long requestedEntriesCount = argc > 1 ? strtol(argv[1], NULL, 10) : DEFAULT_ENTRIES_COUNT;
+    const size_t entriesCount = requestedEntriesCount > 0 ? (size_t)requestedEntriesCount : DEFAULT_ENTRIES_COUNT;
+
+    char* keys = createKeys(entriesCount, "key");
+    char* missingKeys = createKeys(entriesCount, "missing");
+    ListElementsPool* elementsPool = createListElementsPool(entriesCount / ELEMENTS_POOL_SLICE_SIZE + 1);
+    bool success = keys != NULL && missingKeys != NULL && elementsPool != NULL;
+
+    if (success)
+    {
+        BenchmarkResults results;
+
+        printf("Entries count: %zu, lookup rounds: %d (times in ns per operation)\n\n", entriesCount, LOOKUP_ROUNDS);
+        printf("%-26s %10s %10s %10s %10s %10s\n", "Table", "insert", "lookup", "batched", "miss", "erase");
+
+        success = benchmarkHashTable(keys, missingKeys, entriesCount, NULL, &results);
+
+        if (success)
+        {
+            printResults("chained (heap elements)", &results, entriesCount);
+            success = benchmarkHashTable(keys, missingKeys, entriesCount, elementsPool, &results);
+        }
+
+        if (success)
+        {
+            printResults("chained (pool elements)", &results, entriesCount);
+            success = benchmarkFlatHashTable(keys, missingKeys, entriesCount, &results);
+        }
+
+        if (success)
+        {
+            printResults("flat (open addressing)", &results, entriesCount);
+        }
+    }
+
+    if (!success)
+    {
+        fprintf(stderr, "The benchmark could not be completed\n");
+    }
+
+    deleteListElementsPool(elementsPool);
+    free(missingKeys);
+    free(keys);
+
+    return success ? 0 : 1;
+}
+
+static double getCurrentTime()
+{
+    struct timespec currentTime;
+    timespec_get(&currentTime, TIME_UTC);
+
+    return (double)currentTime.tv_sec * 1e9 + (double)currentTime.tv_nsec;
+}
+
+// keys are stored in a single buffer, each one occupying KEY_SIZE chars
+static char* createKeys(size_t entriesCount, const char* prefix)
+{
+    char* keys = (char*)malloc(entriesCount * KEY_SIZE);
+
+    if (keys != NULL)
+    {
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            snprintf(keys + index * KEY_SIZE, KEY_SIZE, "%s_%zu", prefix, index * 7919);
+        }
+    }
+
+    return keys;
+}
+
+static bool benchmarkHashTable(const char* keys, const char* missingKeys, size_t entriesCount, void* elementsPool,
+                               BenchmarkResults* results)
+{
+    HashTable* hashTable = createHashTable(16, elementsPool);
+    size_t foundEntriesCount = 0;
+
+    if (hashTable != NULL)
+    {
+        double startTime = getCurrentTime();
+
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            insertHashEntry(keys + index * KEY_SIZE, "value", hashTable);
+        }
+
+        results->insertTime = getCurrentTime() - startTime;
+        startTime = getCurrentTime();
+
+        for (size_t round = 0; round < LOOKUP_ROUNDS; ++round)
+        {
+            for (size_t index = 0; index < entriesCount; ++index)
+            {
+                foundEntriesCount += getHashEntryValue(keys + index * KEY_SIZE, hashTable) != NULL ? 1 : 0;
+            }
+        }
+
+        results->lookupTime = (getCurrentTime() - startTime) / LOOKUP_ROUNDS;
+        results->batchedLookupTime = benchmarkBatchedLookup(keys, entriesCount, hashTable, &foundEntriesCount);
+        startTime = getCurrentTime();
+
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            foundEntriesCount += getHashEntryValue(missingKeys + index * KEY_SIZE, hashTable) != NULL ? 1 : 0;
+        }
+
+        results->missingLookupTime = getCurrentTime() - startTime;
+        startTime = getCurrentTime();
+
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            eraseHashEntry(keys + index * KEY_SIZE, hashTable);
+        }
+
+        results->eraseTime = getCurrentTime() - startTime;
+        deleteHashTable(hashTable);
+        hashTable = NULL;
+    }
+
+    return foundEntriesCount == entriesCount * LOOKUP_ROUNDS * 2;
+}
+
+// same lookup rounds as for the individual lookups, LOOKUP_BATCH_SIZE keys per call
+static double benchmarkBatchedLookup(const char* keys, size_t entriesCount, HashTable* hashTable,
+                                     size_t* foundEntriesCount)
+{
+    const char* batchKeys[LOOKUP_BATCH_SIZE];
+    const char* batchValues[LOOKUP_BATCH_SIZE];
+    double lookupTime = 0.0;
+
+    for (size_t round = 0; round < LOOKUP_ROUNDS; ++round)
+    {
+        for (size_t batchStart = 0; batchStart < entriesCount; batchStart += LOOKUP_BATCH_SIZE)
+        {
+            const size_t batchSize =
+                entriesCount - batchStart < LOOKUP_BATCH_SIZE ? entriesCount - batchStart : LOOKUP_BATCH_SIZE;
+
+            // gathering the key pointers is not timed (the keys of a request would already be available)
+            for (size_t index = 0; index < batchSize; ++index)
+            {
+                batchKeys[index] = keys + (batchStart + index) * KEY_SIZE;
+            }
+
+            const double startTime = getCurrentTime();
+            *foundEntriesCount += getHashEntryValues(batchKeys, batchSize, batchValues, hashTable);
+            lookupTime += getCurrentTime() - startTime;
+        }
+    }
+
+    return lookupTime / LOOKUP_ROUNDS;
+}
+
+static bool benchmarkFlatHashTable(const char* keys, const char* missingKeys, size_t entriesCount,
+                                   BenchmarkResults* results)
+{
+    FlatHashTable* hashTable = createFlatHashTable(0);
+    size_t foundEntriesCount = 0;
+
+    if (hashTable != NULL)
+    {
+        double startTime = getCurrentTime();
+
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            insertFlatHashEntry(keys + index * KEY_SIZE, "value", hashTable);
+        }
+
+        results->insertTime = getCurrentTime() - startTime;
+        startTime = getCurrentTime();
+
+        for (size_t round = 0; round < LOOKUP_ROUNDS; ++round)
+        {
+            for (size_t index = 0; index < entriesCount; ++index)
+            {
+                foundEntriesCount += getFlatHashEntryValue(keys + index * KEY_SIZE, hashTable) != NULL ? 1 : 0;
+            }
+        }
+
+        results->lookupTime = (getCurrentTime() - startTime) / LOOKUP_ROUNDS;
+        results->batchedLookupTime = 0.0;
+        startTime = getCurrentTime();
+
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            foundEntriesCount += getFlatHashEntryValue(missingKeys + index * KEY_SIZE, hashTable) != NULL ? 1 : 0;
+        }
+
+        results->missingLookupTime = getCurrentTime() - startTime;
+        startTime = getCurrentTime();
+
+        for (size_t index = 0; index < entriesCount; ++index)
+        {
+            eraseFlatHashEntry(keys + index * KEY_SIZE, hashTable);
+        }
+
+        results->eraseTime = getCurrentTime() - startTime;
+        deleteFlatHashTable(hashTable);
+        hashTable = NULL;
+    }
+
+    return foundEntriesCount == entriesCount * LOOKUP_ROUNDS;
+}
+
+static void printResults(const char* tableType, const BenchmarkResults* results, size_t entriesCount)
+{
+    printf("%-26s %10.1f %10.1f ", tableType, results->insertTime / entriesCount, results->lookupTime / entriesCount);
+
+    if (results->batchedLookupTime > 0.0)
+    {
+        printf("%10.1f ", results->batchedLookupTime / entriesCount);
+    }
+    else
+    {
+        printf("%10s ", "-");
+    }
+
+    printf("%10.1f %10.1f\n", results->missingLookupTime / entriesCount, results->eraseTime / entriesCount);
+}
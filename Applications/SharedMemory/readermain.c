@@ -2,35 +2,19 @@
 #include <semaphore.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
-#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
-#include "listprintutils.h"
+#include "compactlist.h"
 
-#define BYTES_COUNT 512
 #define PERMISSIONS 0644
+#define LIST_SLOT 0
 
-static const char* dataFile = "/listdata";
+static const char* poolName = "/listpool";
 static const char* semaphoreName = "listSemaphore";
 
 int main()
 {
-    int fd = shm_open(dataFile, O_RDWR, PERMISSIONS);
-    if (fd < 0)
-    {
-        perror("Error in getting file descriptor");
-        exit(-1);
-    }
-
-    void* sharedMemory = mmap(NULL, BYTES_COUNT, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-    if (sharedMemory == NULL)
-    {
-        perror("Segment access error");
-        exit(-1);
-    }
-
     sem_t* semaphore = sem_open(semaphoreName, O_CREAT, PERMISSIONS, 0);
     if (semaphore == NULL)
     {
@@ -38,53 +22,53 @@ int main()
         exit(-1);
     }
 
-    List* list = NULL;
-
     if (!sem_wait(semaphore))
     {
-        Priority* readAddress = (Priority*)sharedMemory;
-        printf("Gained access to shared memory. Checking payload data size...\n");
+        CompactElementsPool* elementsPool = openSharedCompactElementsPool(poolName);
+        if (elementsPool == NULL)
+        {
+            perror("Shared memory pool access error");
+            exit(-1);
+        }
+
+        printf("Gained access to shared memory. Attaching to the list...\n");
         sleep(1);
-        size_t payloadSize = *readAddress++;
-        printf("Done\n\n");
 
-        if (payloadSize > 0)
+        // the list elements reside in shared memory: no copying, the list gets sorted in place
+        CompactList* list = attachPublishedCompactList(elementsPool, LIST_SLOT);
+
+        if (list != NULL && getCompactListSize(list) > 0)
         {
-            list = createListFromPrioritiesArray(readAddress, payloadSize, NULL);
-            if (list != NULL)
-            {
-                sortAscendingByPriority(list);
-                sleep(1);
-                printf("The list has been created. After sorting it has following content:\n\n");
-                printList(list);
-                readAddress += payloadSize;
-                sleep(1);
-                printf("\nAdditional message from sender: \n");
-                sleep(1);
-                printf("%s\n\n", (char*)readAddress);
-                sleep(1);
-                deleteList(list, deleteObjectPayload);
-                list = NULL;
-            }
-            else
+            printf("Done\n\n");
+            sortCompactListAscendingByPriority(list);
+            publishCompactList(list, LIST_SLOT);
+            sleep(1);
+            printf("The list has been sorted in place. It has following content:\n\n");
+
+            for (CompactElementId elementId = list->first; elementId != COMPACT_NULL_ELEMENT_ID;
+                 elementId = getNextCompactListElementId(list, elementId))
             {
-                printf("Unable to create reader list: no memory allocated\n");
-                exit(-1);
+                printf("Priority: %u\n", getCompactListElementPriority(list, elementId));
             }
+
+            printf("\n");
         }
         else
         {
-            printf("No payload data available, cannot create list\n");
+            printf("No list data available\n");
             exit(-1);
         }
 
+        detachCompactList(list); // the elements are owned by the writer
+        list = NULL;
+
+        deleteCompactElementsPool(elementsPool);
+        elementsPool = NULL;
+
         sem_post(semaphore);
     }
 
-    munmap(sharedMemory, BYTES_COUNT);
-    close(fd);
     sem_close(semaphore);
-    unlink(dataFile);
 
     return 0;
 }
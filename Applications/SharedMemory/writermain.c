@@ -2,45 +2,40 @@
 #include <semaphore.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
-#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
-#include "codeutils.h"
-#include "listelement.h"
+#include "compactlist.h"
 
-#define BYTES_COUNT 512
 #define PERMISSIONS 0644
 #define READ_ACCESS_TIME 15
+#define LIST_SLOT 0
 
-static const char* dataFile = "/listdata";
+static const char* poolName = "/listpool";
 static const char* semaphoreName = "listSemaphore";
 
 static const size_t nrOfPriorities = 5;
 static const Priority priorities[] = {6, 2, 7, 3, 4};
-static const char* endMessage = "Sorry mate, this is all I've got!";
 
 int main()
 {
-    int fd = shm_open(dataFile, O_RDWR | O_CREAT, PERMISSIONS);
-    if (fd < 0)
+    // the list elements are created directly within shared memory, the reader accesses them without any copying
+    CompactElementsPool* elementsPool = createSharedCompactElementsPool(poolName, 1);
+    if (elementsPool == NULL)
     {
-        perror("Shared memory segment opening error");
+        perror("Shared memory pool creation error");
+        exit(-1);
     }
 
-    ftruncate(fd, BYTES_COUNT);
+    printf("Backing file: /dev/shm%s\n", poolName);
 
-    void* sharedMemory = mmap(NULL, BYTES_COUNT, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-    if (sharedMemory == NULL)
+    CompactList* list = createCompactListFromPrioritiesArray(priorities, nrOfPriorities, elementsPool);
+    if (list == NULL || !publishCompactList(list, LIST_SLOT))
     {
-        perror("Error in getting memory segment");
+        printf("Unable to create the shared list\n");
         exit(-1);
     }
 
-    printf("Shared memory address: %p [0..%d]\n", sharedMemory, BYTES_COUNT - 1);
-    printf("Backing file: /dev/shm%s\n", dataFile);
-
     sem_t* semaphore = sem_open(semaphoreName, O_CREAT, PERMISSIONS, 0);
 
     if (semaphore == NULL)
@@ -49,16 +44,6 @@ int main()
         exit(-1);
     }
 
-    Priority* writeAddress = (Priority*)sharedMemory;
-    *writeAddress++ = nrOfPriorities;
-
-    for (size_t index = 0; index < nrOfPriorities; ++index)
-    {
-        *writeAddress++ = priorities[index];
-    }
-
-    copyNCharsToString((char*)writeAddress, endMessage, strlen(endMessage));
-
     if (sem_post(semaphore) < 0)
     {
         perror("Error in incrementing semaphore");
@@ -67,10 +52,29 @@ int main()
 
     sleep(READ_ACCESS_TIME);
 
-    munmap(sharedMemory, BYTES_COUNT);
-    close(fd);
+    // the reader sorted the list in place and published it back
+    detachCompactList(list);
+    list = attachPublishedCompactList(elementsPool, LIST_SLOT);
+
+    if (list != NULL)
+    {
+        printf("Shared list after being processed by reader:");
+
+        for (CompactElementId elementId = list->first; elementId != COMPACT_NULL_ELEMENT_ID;
+             elementId = getNextCompactListElementId(list, elementId))
+        {
+            printf(" %u", getCompactListElementPriority(list, elementId));
+        }
+
+        printf("\n");
+
+        deleteCompactList(list, NULL);
+        list = NULL;
+    }
+
     sem_close(semaphore);
-    shm_unlink(dataFile);
+    deleteCompactElementsPool(elementsPool); // unlinks the shared memory region
+    elementsPool = NULL;
 
     return 0;
 }
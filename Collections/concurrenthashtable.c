@@ -0,0 +1,489 @@
+#include "concurrenthashtable.h"
+
+#ifdef UNIX_OS
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "error.h"
+
+#define CACHE_LINE_SIZE 64
+
+/* Entry (chain node) allocated as a single block: the key and value chars are stored right after the node header
+   - once published (linked into a chain) only the next link can change
+*/
+typedef struct ConcurrentHashNode
+{
+    _Atomic(struct ConcurrentHashNode*) next;
+    struct ConcurrentHashNode* nextRetired; // used once the node is unlinked (retired), until it gets freed
+    uint64_t keyHash;
+    size_t keyLength;
+    char* key;
+    char* value;
+} ConcurrentHashNode;
+
+// each reader slot occupies its own cache line so readers running on different cores don't invalidate each other
+typedef struct
+{
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t activeReadersCount[2]; // indexed by epoch parity
+} ReaderSlot;
+
+typedef struct
+{
+    _Atomic(ConcurrentHashNode*)* buckets;
+    size_t hashSize;
+    pthread_mutex_t locks[CONCURRENT_HASH_LOCKS_COUNT];
+    ReaderSlot* readerSlots;
+    atomic_size_t epoch;
+    atomic_size_t entriesCount;
+    pthread_mutex_t reclaimLock; // protects the retired nodes list
+    ConcurrentHashNode* retiredNodes;
+    size_t retiredNodesCount;
+} ConcurrentHashTableContent;
+
+// "private" (supporting) functions
+static size_t _getConcurrentBucketsCount(const size_t requestedHashSize);
+static ConcurrentHashNode* _createConcurrentHashNode(const char* key, size_t keyLength, uint64_t keyHash,
+                                                     const char* value);
+static bool _isMatchingNode(const ConcurrentHashNode* node, const char* key, size_t keyLength, uint64_t keyHash);
+static pthread_mutex_t* _getBucketLock(ConcurrentHashTableContent* content, size_t bucketIndex);
+static size_t _getReaderSlotIndex();
+static size_t _enterReadSection(ConcurrentHashTableContent* content, ReaderSlot* readerSlot);
+static void _retireNode(ConcurrentHashTableContent* content, ConcurrentHashNode* node);
+static void _reclaimRetiredNodes(ConcurrentHashTableContent* content);
+static void _freeNodes(ConcurrentHashNode* firstNode, bool isRetiredNodesList);
+
+ConcurrentHashTable* createConcurrentHashTable(const size_t hashSize)
+{
+    ConcurrentHashTable* hashTable = NULL;
+    const size_t bucketsCount = _getConcurrentBucketsCount(hashSize);
+
+    if (bucketsCount > 0)
+    {
+        hashTable = (ConcurrentHashTable*)malloc(sizeof(ConcurrentHashTable));
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)malloc(sizeof(ConcurrentHashTableContent));
+        _Atomic(ConcurrentHashNode*)* buckets =
+            (_Atomic(ConcurrentHashNode*)*)malloc(bucketsCount * sizeof(_Atomic(ConcurrentHashNode*)));
+        ReaderSlot* readerSlots =
+            (ReaderSlot*)aligned_alloc(CACHE_LINE_SIZE, CONCURRENT_HASH_READER_SLOTS_COUNT * sizeof(ReaderSlot));
+
+        if (hashTable != NULL && content != NULL && buckets != NULL && readerSlots != NULL)
+        {
+            for (size_t bucketIndex = 0; bucketIndex < bucketsCount; ++bucketIndex)
+            {
+                atomic_init(&buckets[bucketIndex], NULL);
+            }
+
+            for (size_t slotIndex = 0; slotIndex < CONCURRENT_HASH_READER_SLOTS_COUNT; ++slotIndex)
+            {
+                atomic_init(&readerSlots[slotIndex].activeReadersCount[0], 0);
+                atomic_init(&readerSlots[slotIndex].activeReadersCount[1], 0);
+            }
+
+            for (size_t lockIndex = 0; lockIndex < CONCURRENT_HASH_LOCKS_COUNT; ++lockIndex)
+            {
+                pthread_mutex_init(&content->locks[lockIndex], NULL);
+            }
+
+            pthread_mutex_init(&content->reclaimLock, NULL);
+
+            content->buckets = buckets;
+            content->hashSize = bucketsCount;
+            content->readerSlots = readerSlots;
+            atomic_init(&content->epoch, 0);
+            atomic_init(&content->entriesCount, 0);
+            content->retiredNodes = NULL;
+            content->retiredNodesCount = 0;
+
+            hashTable->tableContent = content;
+        }
+        else
+        {
+            FREE(readerSlots);
+            FREE(buckets);
+            FREE(content);
+            FREE(hashTable);
+        }
+    }
+
+    return hashTable;
+}
+
+void deleteConcurrentHashTable(ConcurrentHashTable* hashTable)
+{
+    if (hashTable != NULL)
+    {
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        for (size_t bucketIndex = 0; bucketIndex < content->hashSize; ++bucketIndex)
+        {
+            _freeNodes(atomic_load_explicit(&content->buckets[bucketIndex], memory_order_relaxed), false);
+        }
+
+        _freeNodes(content->retiredNodes, true);
+
+        for (size_t lockIndex = 0; lockIndex < CONCURRENT_HASH_LOCKS_COUNT; ++lockIndex)
+        {
+            pthread_mutex_destroy(&content->locks[lockIndex]);
+        }
+
+        pthread_mutex_destroy(&content->reclaimLock);
+
+        free(content->readerSlots);
+        content->readerSlots = NULL;
+        free(content->buckets);
+        content->buckets = NULL;
+        free(content);
+        content = NULL;
+        free(hashTable);
+        hashTable = NULL;
+    }
+}
+
+/* Same semantics as for the HashTable:
+   - if the key doesn't exist, the entry is inserted
+   - if the key exists and the value is different, the entry is replaced by one containing the new value
+   - false is returned if no change occurred
+*/
+bool insertConcurrentHashEntry(const char* key, const char* value, ConcurrentHashTable* hashTable)
+{
+    bool success = false;
+
+    if (key != NULL && value != NULL && hashTable != NULL && strlen(key) > 0 && strlen(value) > 0)
+    {
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        const size_t keyLength = strlen(key);
+        const uint64_t keyHash = computeHash(key, keyLength);
+        const size_t bucketIndex = (size_t)(keyHash & (content->hashSize - 1));
+        pthread_mutex_t* bucketLock = _getBucketLock(content, bucketIndex);
+        ConcurrentHashNode* replacedNode = NULL;
+
+        pthread_mutex_lock(bucketLock);
+
+        // the chain is only modified by lock owners, so the links can be read without synchronization
+        _Atomic(ConcurrentHashNode*)* link = &content->buckets[bucketIndex];
+        ConcurrentHashNode* currentNode = atomic_load_explicit(link, memory_order_relaxed);
+
+        while (currentNode != NULL && !_isMatchingNode(currentNode, key, keyLength, keyHash))
+        {
+            link = &currentNode->next;
+            currentNode = atomic_load_explicit(link, memory_order_relaxed);
+        }
+
+        if (currentNode == NULL || strcmp(currentNode->value, value) != 0)
+        {
+            ConcurrentHashNode* newNode = _createConcurrentHashNode(key, keyLength, keyHash, value);
+
+            if (newNode != NULL && currentNode != NULL)
+            {
+                atomic_init(&newNode->next, atomic_load_explicit(&currentNode->next, memory_order_relaxed));
+
+                // release: a reader reaching the new node sees its content
+                atomic_store_explicit(link, newNode, memory_order_release);
+                replacedNode = currentNode;
+                success = true;
+            }
+            else if (newNode != NULL)
+            {
+                atomic_init(&newNode->next, atomic_load_explicit(&content->buckets[bucketIndex], memory_order_relaxed));
+                atomic_store_explicit(&content->buckets[bucketIndex], newNode, memory_order_release);
+                atomic_fetch_add_explicit(&content->entriesCount, 1, memory_order_relaxed);
+                success = true;
+            }
+        }
+
+        pthread_mutex_unlock(bucketLock);
+
+        if (replacedNode != NULL)
+        {
+            _retireNode(content, replacedNode);
+        }
+    }
+
+    return success;
+}
+
+void eraseConcurrentHashEntry(const char* key, ConcurrentHashTable* hashTable)
+{
+    if (key != NULL && hashTable != NULL && strlen(key) > 0)
+    {
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        const size_t keyLength = strlen(key);
+        const uint64_t keyHash = computeHash(key, keyLength);
+        const size_t bucketIndex = (size_t)(keyHash & (content->hashSize - 1));
+        pthread_mutex_t* bucketLock = _getBucketLock(content, bucketIndex);
+
+        pthread_mutex_lock(bucketLock);
+
+        _Atomic(ConcurrentHashNode*)* link = &content->buckets[bucketIndex];
+        ConcurrentHashNode* currentNode = atomic_load_explicit(link, memory_order_relaxed);
+
+        while (currentNode != NULL && !_isMatchingNode(currentNode, key, keyLength, keyHash))
+        {
+            link = &currentNode->next;
+            currentNode = atomic_load_explicit(link, memory_order_relaxed);
+        }
+
+        if (currentNode != NULL)
+        {
+            // the erased node keeps its next link so readers currently visiting it can continue traversing the chain
+            atomic_store_explicit(link, atomic_load_explicit(&currentNode->next, memory_order_relaxed),
+                                  memory_order_release);
+            atomic_fetch_sub_explicit(&content->entriesCount, 1, memory_order_relaxed);
+        }
+
+        pthread_mutex_unlock(bucketLock);
+
+        if (currentNode != NULL)
+        {
+            _retireNode(content, currentNode);
+        }
+    }
+}
+
+bool getConcurrentHashEntryValue(const char* key, ConcurrentHashTable* hashTable, char* value, size_t maxValueSize)
+{
+    bool found = false;
+
+    if (key != NULL && hashTable != NULL && value != NULL && maxValueSize > 0 && strlen(key) > 0)
+    {
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        const size_t keyLength = strlen(key);
+        const uint64_t keyHash = computeHash(key, keyLength);
+        const size_t bucketIndex = (size_t)(keyHash & (content->hashSize - 1));
+        ReaderSlot* readerSlot = &content->readerSlots[_getReaderSlotIndex()];
+        const size_t epochParity = _enterReadSection(content, readerSlot);
+
+        ConcurrentHashNode* currentNode = atomic_load_explicit(&content->buckets[bucketIndex], memory_order_acquire);
+
+        while (currentNode != NULL && !found)
+        {
+            if (_isMatchingNode(currentNode, key, keyLength, keyHash))
+            {
+                const size_t valueLength = strlen(currentNode->value);
+                const size_t copiedCharsCount = valueLength < maxValueSize - 1 ? valueLength : maxValueSize - 1;
+
+                memcpy(value, currentNode->value, copiedCharsCount);
+                value[copiedCharsCount] = '\0';
+                found = true;
+            }
+            else
+            {
+                currentNode = atomic_load_explicit(&currentNode->next, memory_order_acquire);
+            }
+        }
+
+        // leaving the read section: the visited nodes might get freed from now on
+        atomic_fetch_sub(&readerSlot->activeReadersCount[epochParity], 1);
+    }
+
+    return found;
+}
+
+size_t getConcurrentHashTableEntriesCount(const ConcurrentHashTable* hashTable)
+{
+    size_t entriesCount = 0;
+
+    if (hashTable != NULL)
+    {
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        entriesCount = atomic_load_explicit(&content->entriesCount, memory_order_relaxed);
+    }
+
+    return entriesCount;
+}
+
+size_t getConcurrentHashIndexesCount(const ConcurrentHashTable* hashTable)
+{
+    size_t hashIndexesCount = 0;
+
+    if (hashTable != NULL)
+    {
+        const ConcurrentHashTableContent* content = (const ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        hashIndexesCount = content->hashSize;
+    }
+
+    return hashIndexesCount;
+}
+
+size_t getConcurrentHashRetiredEntriesCount(ConcurrentHashTable* hashTable)
+{
+    size_t retiredEntriesCount = 0;
+
+    if (hashTable != NULL)
+    {
+        ConcurrentHashTableContent* content = (ConcurrentHashTableContent*)hashTable->tableContent;
+        ASSERT(content != NULL, "Invalid hash table content!");
+
+        pthread_mutex_lock(&content->reclaimLock);
+        retiredEntriesCount = content->retiredNodesCount;
+        pthread_mutex_unlock(&content->reclaimLock);
+    }
+
+    return retiredEntriesCount;
+}
+
+static size_t _getConcurrentBucketsCount(const size_t requestedHashSize)
+{
+    size_t bucketsCount = 0;
+
+    if (requestedHashSize > 0 && requestedHashSize <= ((size_t)1 << (sizeof(size_t) * 8 - 1)))
+    {
+        bucketsCount = 1;
+
+        while (bucketsCount < requestedHashSize)
+        {
+            bucketsCount <<= 1;
+        }
+    }
+
+    return bucketsCount;
+}
+
+static ConcurrentHashNode* _createConcurrentHashNode(const char* key, size_t keyLength, uint64_t keyHash,
+                                                     const char* value)
+{
+    const size_t valueLength = strlen(value);
+    ConcurrentHashNode* node = (ConcurrentHashNode*)malloc(sizeof(ConcurrentHashNode) + keyLength + valueLength + 2);
+
+    if (node != NULL)
+    {
+        node->nextRetired = NULL;
+        node->keyHash = keyHash;
+        node->keyLength = keyLength;
+        node->key = (char*)(node + 1);
+        node->value = node->key + keyLength + 1;
+
+        memcpy(node->key, key, keyLength + 1);
+        memcpy(node->value, value, valueLength + 1);
+    }
+
+    return node;
+}
+
+static bool _isMatchingNode(const ConcurrentHashNode* node, const char* key, size_t keyLength, uint64_t keyHash)
+{
+    ASSERT(node != NULL && key != NULL, "Null pointer arguments detected");
+
+    return node->keyHash == keyHash && node->keyLength == keyLength && memcmp(node->key, key, keyLength) == 0;
+}
+
+static pthread_mutex_t* _getBucketLock(ConcurrentHashTableContent* content, size_t bucketIndex)
+{
+    ASSERT(content != NULL, "Null pointer argument detected");
+
+    return &content->locks[bucketIndex & (CONCURRENT_HASH_LOCKS_COUNT - 1)];
+}
+
+// the slot is chosen once per thread, threads are spread among slots based on the address of a thread local variable
+static size_t _getReaderSlotIndex()
+{
+    static _Thread_local char threadMarker;
+    static _Thread_local size_t readerSlotIndex = SIZE_MAX;
+
+    if (readerSlotIndex == SIZE_MAX)
+    {
+        const uintptr_t threadMarkerAddress = (uintptr_t)&threadMarker;
+        const uint64_t threadMarkerHash = computeHash(&threadMarkerAddress, sizeof(threadMarkerAddress));
+        readerSlotIndex = (size_t)(threadMarkerHash % CONCURRENT_HASH_READER_SLOTS_COUNT);
+    }
+
+    return readerSlotIndex;
+}
+
+/* Announces the reader for the current epoch and returns the epoch parity (to be used when leaving the read section)
+   - the epoch is checked again after announcing, otherwise a reclaimer that flipped the epoch in-between might not
+   wait for this reader
+*/
+static size_t _enterReadSection(ConcurrentHashTableContent* content, ReaderSlot* readerSlot)
+{
+    ASSERT(content != NULL && readerSlot != NULL, "Null pointer arguments detected");
+
+    size_t epoch = atomic_load(&content->epoch);
+    atomic_fetch_add(&readerSlot->activeReadersCount[epoch & 1], 1);
+
+    while (atomic_load(&content->epoch) != epoch)
+    {
+        atomic_fetch_sub(&readerSlot->activeReadersCount[epoch & 1], 1);
+        epoch = atomic_load(&content->epoch);
+        atomic_fetch_add(&readerSlot->activeReadersCount[epoch & 1], 1);
+    }
+
+    return epoch & 1;
+}
+
+// should be called after the node has been unlinked and without holding any bucket lock
+static void _retireNode(ConcurrentHashTableContent* content, ConcurrentHashNode* node)
+{
+    ASSERT(content != NULL && node != NULL, "Null pointer arguments detected");
+
+    pthread_mutex_lock(&content->reclaimLock);
+
+    node->nextRetired = content->retiredNodes;
+    content->retiredNodes = node;
+    ++content->retiredNodesCount;
+
+    if (content->retiredNodesCount >= CONCURRENT_HASH_RECLAIM_THRESHOLD)
+    {
+        _reclaimRetiredNodes(content);
+    }
+
+    pthread_mutex_unlock(&content->reclaimLock);
+}
+
+/* Grace period (the reclaim lock should be owned by the caller):
+   - the retired nodes are no longer reachable from the buckets, so only readers that entered before the epoch flip
+   might still access them
+   - once the reader slots of the previous epoch parity are drained, the nodes can be safely freed
+*/
+static void _reclaimRetiredNodes(ConcurrentHashTableContent* content)
+{
+    ASSERT(content != NULL, "Null pointer argument detected");
+
+    ConcurrentHashNode* retiredNodes = content->retiredNodes;
+    content->retiredNodes = NULL;
+    content->retiredNodesCount = 0;
+
+    const size_t previousEpochParity = atomic_fetch_add(&content->epoch, 1) & 1;
+
+    for (size_t slotIndex = 0; slotIndex < CONCURRENT_HASH_READER_SLOTS_COUNT; ++slotIndex)
+    {
+        while (atomic_load(&content->readerSlots[slotIndex].activeReadersCount[previousEpochParity]) > 0)
+        {
+            sched_yield();
+        }
+    }
+
+    _freeNodes(retiredNodes, true);
+}
+
+static void _freeNodes(ConcurrentHashNode* firstNode, bool isRetiredNodesList)
+{
+    ConcurrentHashNode* currentNode = firstNode;
+
+    while (currentNode != NULL)
+    {
+        ConcurrentHashNode* nextNode = isRetiredNodesList
+                                           ? currentNode->nextRetired
+                                           : atomic_load_explicit(&currentNode->next, memory_order_relaxed);
+        free(currentNode);
+        currentNode = nextNode;
+    }
+}
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "codeutils.h"
+
+#define CONCURRENT_HASH_LOCKS_COUNT 64        // each lock protects the buckets having the same index modulo locks count
+#define CONCURRENT_HASH_READER_SLOTS_COUNT 64 // reader indicators, each one on its own cache line
+#define CONCURRENT_HASH_RECLAIM_THRESHOLD 64  // retired entries count that triggers the memory reclamation
+
+/* Thread-safe hash table (UNIX only) with the same entries semantics as the HashTable
+   - writers (insert/erase) lock only the stripe (group of buckets) the key belongs to
+   - readers don't take any lock: the bucket chains are traversed through atomic links and an entry never changes
+   once published (an updated value replaces the whole entry), so a reader either sees the old or the new entry
+   - erased/replaced entries are retired and freed only after all readers that might still access them are done: each
+   reader announces itself in one of the reader slots for the current (global) epoch parity, the reclaimer flips the
+   epoch and waits until the slots of the previous parity are drained (RCU-like grace period)
+   - as the entries might get freed once the lookup is done, the value is copied to a caller provided buffer
+   - the number of buckets is fixed (rounded up to a power of two), choose it according to the expected entries count
+*/
+typedef struct
+{
+    void* tableContent;
+} ConcurrentHashTable;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef UNIX_OS
+    ConcurrentHashTable* createConcurrentHashTable(const size_t hashSize);
+    void deleteConcurrentHashTable(ConcurrentHashTable* hashTable); // no other thread should access the table
+    bool insertConcurrentHashEntry(const char* key, const char* value, ConcurrentHashTable* hashTable);
+    void eraseConcurrentHashEntry(const char* key, ConcurrentHashTable* hashTable);
+
+    // copies the value (truncated to maxValueSize - 1 chars) and returns true if the key is found
+    bool getConcurrentHashEntryValue(const char* key, ConcurrentHashTable* hashTable, char* value,
+                                     size_t maxValueSize);
+    size_t getConcurrentHashTableEntriesCount(const ConcurrentHashTable* hashTable);
+    size_t getConcurrentHashIndexesCount(const ConcurrentHashTable* hashTable);
+
+    // for testing purposes only
+    size_t getConcurrentHashRetiredEntriesCount(ConcurrentHashTable* hashTable); // not yet freed
+#endif
+
+#ifdef __cplusplus
+}
+#endif
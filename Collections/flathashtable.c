@@ -0,0 +1,406 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "codeutils.h"
+#include "error.h"
+#include "flathashtable.h"
+
+#define FLAT_HASH_OFFSET 4
+
+#define EMPTY_SLOT_CONTROL_BYTE ((int8_t)-128)
+#define DELETED_SLOT_CONTROL_BYTE ((int8_t)-2)
+
+typedef struct
+{
+    char* key;
+    char* value;
+} FlatHashSlot;
+
+typedef uint32_t GroupMask; // bit i set: slot i of the group matches
+
+// "private" (supporting) functions
+static size_t _getFlatHashCapacity(const size_t requestedCapacity);
+static size_t _getMaxEntriesCount(const size_t capacity);
+static bool _createControlBytesAndSlots(const size_t capacity, int8_t** controlBytes, FlatHashSlot** slots);
+static GroupMask _matchControlByte(const int8_t* group, int8_t controlByte);
+static GroupMask _matchEmptyOrDeletedSlots(const int8_t* group);
+static size_t _getFirstMatchingSlot(GroupMask mask);
+static bool _findSlot(const FlatHashTable* hashTable, const char* key, uint64_t keyHash, size_t* slotIndex);
+static size_t _findInsertionSlot(const FlatHashTable* hashTable, uint64_t keyHash);
+static bool _rehashFlatHashTable(FlatHashTable* hashTable, const size_t newCapacity);
+
+FlatHashTable* createFlatHashTable(const size_t capacity)
+{
+    FlatHashTable* hashTable = NULL;
+    const size_t actualCapacity = _getFlatHashCapacity(capacity);
+
+    // the offset bytes are required in order to prevent de-allocating data by deleting pointer to the first category
+    // (hash table object)
+    void* data = actualCapacity > 0 ? malloc(FLAT_HASH_OFFSET + sizeof(FlatHashTable)) : NULL;
+    int8_t* controlBytes = NULL;
+    FlatHashSlot* slots = NULL;
+
+    if (data != NULL && _createControlBytesAndSlots(actualCapacity, &controlBytes, &slots))
+    {
+        hashTable = (FlatHashTable*)(data + FLAT_HASH_OFFSET);
+        hashTable->controlBytes = controlBytes;
+        hashTable->entrySlots = slots;
+        hashTable->capacity = actualCapacity;
+        hashTable->entriesCount = 0;
+        hashTable->growthLeft = _getMaxEntriesCount(actualCapacity);
+        hashTable->data = data;
+    }
+    else
+    {
+        FREE(data);
+    }
+
+    return hashTable;
+}
+
+void deleteFlatHashTable(FlatHashTable* hashTable)
+{
+    void* data = hashTable != NULL ? hashTable->data : NULL;
+    int8_t* controlBytes = hashTable != NULL ? (int8_t*)hashTable->controlBytes : NULL;
+    FlatHashSlot* slots = hashTable != NULL ? (FlatHashSlot*)hashTable->entrySlots : NULL;
+
+    ASSERT(hashTable == NULL || data != NULL && controlBytes != NULL && slots != NULL, "Invalid hash table!");
+
+    if (controlBytes != NULL && slots != NULL)
+    {
+        for (size_t slotIndex = 0; slotIndex < hashTable->capacity; ++slotIndex)
+        {
+            if (controlBytes[slotIndex] >= 0)
+            {
+                free(slots[slotIndex].key);
+                free(slots[slotIndex].value);
+            }
+        }
+    }
+
+    FREE(controlBytes);
+    FREE(slots);
+    FREE(data);
+}
+
+bool insertFlatHashEntry(const char* key, const char* value, FlatHashTable* hashTable)
+{
+    bool success = false;
+
+    if (key != NULL && value != NULL && hashTable != NULL && strlen(key) > 0 && strlen(value) > 0)
+    {
+        const uint64_t keyHash = computeHash(key, strlen(key));
+        FlatHashSlot* slots = (FlatHashSlot*)hashTable->entrySlots;
+        size_t slotIndex;
+
+        if (_findSlot(hashTable, key, keyHash, &slotIndex))
+        {
+            if (strcmp(slots[slotIndex].value, value) != 0)
+            {
+                char* newValue = createStringCopy(value);
+
+                if (newValue != NULL)
+                {
+                    free(slots[slotIndex].value);
+                    slots[slotIndex].value = newValue;
+                    success = true;
+                }
+            }
+        }
+        else
+        {
+            // a table full of deleted slots is rehashed in place, otherwise it grows
+            if (hashTable->growthLeft == 0)
+            {
+                const size_t newCapacity = hashTable->entriesCount < _getMaxEntriesCount(hashTable->capacity) / 2
+                                               ? hashTable->capacity
+                                               : hashTable->capacity * 2;
+
+                (void)_rehashFlatHashTable(hashTable, newCapacity);
+            }
+
+            char* entryKey = hashTable->growthLeft > 0 ? createStringCopy(key) : NULL;
+            char* entryValue = entryKey != NULL ? createStringCopy(value) : NULL;
+
+            if (entryValue != NULL)
+            {
+                int8_t* controlBytes = (int8_t*)hashTable->controlBytes;
+                slots = (FlatHashSlot*)hashTable->entrySlots;
+                slotIndex = _findInsertionSlot(hashTable, keyHash);
+
+                if (controlBytes[slotIndex] == EMPTY_SLOT_CONTROL_BYTE)
+                {
+                    --hashTable->growthLeft;
+                }
+
+                controlBytes[slotIndex] = (int8_t)(keyHash & 0x7F);
+                slots[slotIndex].key = entryKey;
+                slots[slotIndex].value = entryValue;
+                ++hashTable->entriesCount;
+                success = true;
+            }
+            else
+            {
+                FREE(entryKey);
+            }
+        }
+    }
+
+    return success;
+}
+
+void eraseFlatHashEntry(const char* key, FlatHashTable* hashTable)
+{
+    size_t slotIndex;
+
+    if (key != NULL && hashTable != NULL && strlen(key) > 0 &&
+        _findSlot(hashTable, key, computeHash(key, strlen(key)), &slotIndex))
+    {
+        int8_t* controlBytes = (int8_t*)hashTable->controlBytes;
+        FlatHashSlot* slots = (FlatHashSlot*)hashTable->entrySlots;
+        const int8_t* group = controlBytes + slotIndex - slotIndex % FLAT_HASH_GROUP_SIZE;
+
+        FREE(slots[slotIndex].key);
+        FREE(slots[slotIndex].value);
+
+        // no probe sequence continues past a group having an empty slot, so the slot can be marked as empty
+        if (_matchControlByte(group, EMPTY_SLOT_CONTROL_BYTE) != 0)
+        {
+            controlBytes[slotIndex] = EMPTY_SLOT_CONTROL_BYTE;
+            ++hashTable->growthLeft;
+        }
+        else
+        {
+            controlBytes[slotIndex] = DELETED_SLOT_CONTROL_BYTE;
+        }
+
+        --hashTable->entriesCount;
+    }
+}
+
+const char* getFlatHashEntryValue(const char* key, const FlatHashTable* hashTable)
+{
+    const char* result = NULL;
+    size_t slotIndex;
+
+    if (key != NULL && hashTable != NULL && strlen(key) > 0 &&
+        _findSlot(hashTable, key, computeHash(key, strlen(key)), &slotIndex))
+    {
+        result = ((const FlatHashSlot*)hashTable->entrySlots)[slotIndex].value;
+    }
+
+    return result;
+}
+
+size_t getFlatHashTableEntriesCount(const FlatHashTable* hashTable)
+{
+    return hashTable != NULL ? hashTable->entriesCount : 0;
+}
+
+size_t getFlatHashTableCapacity(const FlatHashTable* hashTable)
+{
+    return hashTable != NULL ? hashTable->capacity : 0;
+}
+
+static size_t _getFlatHashCapacity(const size_t requestedCapacity)
+{
+    size_t capacity = FLAT_HASH_GROUP_SIZE;
+
+    while (capacity > 0 && capacity < requestedCapacity)
+    {
+        capacity <<= 1; // becomes 0 on overflow (capacity too large)
+    }
+
+    return capacity;
+}
+
+static size_t _getMaxEntriesCount(const size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+static bool _createControlBytesAndSlots(const size_t capacity, int8_t** controlBytes, FlatHashSlot** slots)
+{
+    bool success = false;
+
+    *controlBytes = capacity <= SIZE_MAX / sizeof(FlatHashSlot) ? (int8_t*)malloc(capacity) : NULL;
+    *slots = *controlBytes != NULL ? (FlatHashSlot*)malloc(capacity * sizeof(FlatHashSlot)) : NULL;
+
+    if (*slots != NULL)
+    {
+        memset(*controlBytes, EMPTY_SLOT_CONTROL_BYTE, capacity);
+        success = true;
+    }
+    else
+    {
+        FREE(*controlBytes);
+    }
+
+    return success;
+}
+
+static GroupMask _matchControlByte(const int8_t* group, int8_t controlByte)
+{
+#ifdef __SSE2__
+    const __m128i groupBytes = _mm_loadu_si128((const __m128i*)group);
+
+    return (GroupMask)_mm_movemask_epi8(_mm_cmpeq_epi8(groupBytes, _mm_set1_epi8(controlByte)));
+#else
+    GroupMask mask = 0;
+
+    for (size_t index = 0; index < FLAT_HASH_GROUP_SIZE; ++index)
+    {
+        mask |= (GroupMask)(group[index] == controlByte) << index;
+    }
+
+    return mask;
+#endif
+}
+
+// the empty and deleted control bytes are the only negative ones
+static GroupMask _matchEmptyOrDeletedSlots(const int8_t* group)
+{
+#ifdef __SSE2__
+    return (GroupMask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    GroupMask mask = 0;
+
+    for (size_t index = 0; index < FLAT_HASH_GROUP_SIZE; ++index)
+    {
+        mask |= (GroupMask)(group[index] < 0) << index;
+    }
+
+    return mask;
+#endif
+}
+
+static size_t _getFirstMatchingSlot(GroupMask mask)
+{
+    ASSERT(mask != 0, "No matching slot!");
+
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_ctz(mask);
+#else
+    size_t slotIndex = 0;
+
+    while ((mask & 1u) == 0)
+    {
+        mask >>= 1;
+        ++slotIndex;
+    }
+
+    return slotIndex;
+#endif
+}
+
+/* Probing is done group by group (triangular sequence, visits all groups as the groups count is a power of two)
+   - the start group is given by the upper hash bits, the lower 7 bits are stored in the control byte
+   - the probe ends at the first group having an empty slot
+*/
+static bool _findSlot(const FlatHashTable* hashTable, const char* key, uint64_t keyHash, size_t* slotIndex)
+{
+    bool found = false;
+    const int8_t* controlBytes = (const int8_t*)hashTable->controlBytes;
+    const FlatHashSlot* slots = (const FlatHashSlot*)hashTable->entrySlots;
+    const size_t groupsMask = hashTable->capacity / FLAT_HASH_GROUP_SIZE - 1;
+    const int8_t controlByte = (int8_t)(keyHash & 0x7F);
+    size_t groupIndex = (size_t)(keyHash >> 7) & groupsMask;
+
+    for (size_t probeIndex = 0; probeIndex <= groupsMask && !found; ++probeIndex)
+    {
+        const int8_t* group = controlBytes + groupIndex * FLAT_HASH_GROUP_SIZE;
+        GroupMask matchingSlots = _matchControlByte(group, controlByte);
+
+        while (matchingSlots != 0)
+        {
+            const size_t currentSlotIndex = groupIndex * FLAT_HASH_GROUP_SIZE + _getFirstMatchingSlot(matchingSlots);
+
+            if (strcmp(slots[currentSlotIndex].key, key) == 0)
+            {
+                *slotIndex = currentSlotIndex;
+                found = true;
+                break;
+            }
+
+            matchingSlots &= matchingSlots - 1;
+        }
+
+        if (_matchControlByte(group, EMPTY_SLOT_CONTROL_BYTE) != 0)
+        {
+            break;
+        }
+
+        groupIndex = (groupIndex + probeIndex + 1) & groupsMask;
+    }
+
+    return found;
+}
+
+// the key is assumed not to be contained in the table, which should have room for it (growth left)
+static size_t _findInsertionSlot(const FlatHashTable* hashTable, uint64_t keyHash)
+{
+    const int8_t* controlBytes = (const int8_t*)hashTable->controlBytes;
+    const size_t groupsMask = hashTable->capacity / FLAT_HASH_GROUP_SIZE - 1;
+    size_t groupIndex = (size_t)(keyHash >> 7) & groupsMask;
+    size_t slotIndex = hashTable->capacity;
+
+    for (size_t probeIndex = 0; probeIndex <= groupsMask; ++probeIndex)
+    {
+        const GroupMask availableSlots = _matchEmptyOrDeletedSlots(controlBytes + groupIndex * FLAT_HASH_GROUP_SIZE);
+
+        if (availableSlots != 0)
+        {
+            slotIndex = groupIndex * FLAT_HASH_GROUP_SIZE + _getFirstMatchingSlot(availableSlots);
+            break;
+        }
+
+        groupIndex = (groupIndex + probeIndex + 1) & groupsMask;
+    }
+
+    ASSERT(slotIndex < hashTable->capacity, "No available slot found!");
+
+    return slotIndex;
+}
+
+// the key/value strings are moved to the new slots, the deleted slots are discarded
+static bool _rehashFlatHashTable(FlatHashTable* hashTable, const size_t newCapacity)
+{
+    bool success = false;
+    int8_t* newControlBytes = NULL;
+    FlatHashSlot* newSlots = NULL;
+
+    if (newCapacity > 0 && _createControlBytesAndSlots(newCapacity, &newControlBytes, &newSlots))
+    {
+        int8_t* controlBytes = (int8_t*)hashTable->controlBytes;
+        FlatHashSlot* slots = (FlatHashSlot*)hashTable->entrySlots;
+        const size_t capacity = hashTable->capacity;
+
+        hashTable->controlBytes = newControlBytes;
+        hashTable->entrySlots = newSlots;
+        hashTable->capacity = newCapacity;
+        hashTable->growthLeft = _getMaxEntriesCount(newCapacity) - hashTable->entriesCount;
+
+        for (size_t slotIndex = 0; slotIndex < capacity; ++slotIndex)
+        {
+            if (controlBytes[slotIndex] >= 0)
+            {
+                const uint64_t keyHash = computeHash(slots[slotIndex].key, strlen(slots[slotIndex].key));
+                const size_t newSlotIndex = _findInsertionSlot(hashTable, keyHash);
+
+                newControlBytes[newSlotIndex] = controlBytes[slotIndex];
+                newSlots[newSlotIndex] = slots[slotIndex];
+            }
+        }
+
+        free(controlBytes);
+        free(slots);
+        success = true;
+    }
+
+    return success;
+}
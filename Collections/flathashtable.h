@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Open addressing hash table (Swiss table layout), an alternative to the chained HashTable for lookup intensive usage
+   - the entries (key/value string pointers) are stored in a flat slots array, no list elements or entry records
+   - each slot has a control byte: empty, deleted or (for full slots) 7 bits of the key hash
+   - the control bytes are probed in groups of FLAT_HASH_GROUP_SIZE (one SSE2 compare per group when available), so
+   a lookup typically compares the key string of a single slot
+   - the capacity is a power of two (at least one group) and the table grows (doubles) when more than 7/8 of the
+   slots are used; erased slots are marked as deleted only when required for keeping the probe sequences intact
+   - the entries semantics (insert/update/erase/lookup) are the same as for the HashTable
+*/
+
+#define FLAT_HASH_GROUP_SIZE 16
+
+typedef struct
+{
+    void* controlBytes;
+    void* entrySlots; // key/value pairs
+    size_t capacity;
+    size_t entriesCount;
+    size_t growthLeft; // remaining empty slots that can be filled before the table needs to grow
+    void* data;        // to be used for FlatHashTable deletion only
+} FlatHashTable;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    FlatHashTable* createFlatHashTable(const size_t capacity); // rounded up to a power of two (min: group size)
+    void deleteFlatHashTable(FlatHashTable* hashTable);
+    bool insertFlatHashEntry(const char* key, const char* value, FlatHashTable* hashTable);
+    void eraseFlatHashEntry(const char* key, FlatHashTable* hashTable);
+
+    const char* getFlatHashEntryValue(const char* key, const FlatHashTable* hashTable);
+    size_t getFlatHashTableEntriesCount(const FlatHashTable* hashTable);
+    size_t getFlatHashTableCapacity(const FlatHashTable* hashTable);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,46 +1,91 @@
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "error.h"
 #include "hashtable.h"
 #include "linkedlist.h"
+#include "slaballocator.h"
 
 #define HASH_OFFSET 4
 
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address)
+#endif
+
 static const int hashEntryType = 'h' + 'a' + 's' + 'h' + 'E' + 'n' + 't' + 'r' + 'y';
 
+// the searched key, hashed only once per hash table operation
+typedef struct
+{
+    const char* key;
+    size_t keyLength;
+    uint64_t keyHash;
+} HashKey;
+
 // "private" (supporting) functions
 static bool _retrieveHashIndex(const char* key, size_t* hashIndex, const size_t hashSize);
-static HashEntry* _createHashEntry(const char* key, const char* value);
-static bool _updateHashEntry(HashEntry* hashEntry, const char* value);
-static HashEntry* _getMatchingKeyHashEntry(const List* currentBucket, const char* key);
-static void _deleteHashEntry(Object* object); // custom deleter for hash table
-static ListElement* _removeElementFromBucket(const char* key, List* bucket);
-static List* _getCurrentBucket(const char* key, HashTable* hashTable);
+static bool _createHashKey(const char* key, HashKey* hashKey); // false for NULL or empty key
+static bool _createHashKeyN(const char* key, size_t keyLength, HashKey* hashKey); // key not necessarily terminated
+static bool _isMatchingHashEntry(const HashEntry* hashEntry, const HashKey* hashKey);
+static size_t _getBucketsCount(const size_t hashSize); // hash size rounded up to a power of two
+static List* _createHashBuckets(const size_t bucketsCount, ListElementsPoolProxy* elementsPoolProxy);
+static bool _resizeHashTable(HashTable* hashTable, const size_t newHashSize); // starts (incremental) rehashing
+static void _rehashHashBuckets(HashTable* hashTable, size_t bucketsCount); // moves the content of old buckets
+static void _adjustHashTableSize(HashTable* hashTable); // grows/shrinks the table according to load factor
+static HashEntry* _createHashEntry(const HashKey* hashKey, const char* value, SlabAllocator* entriesAllocator);
+static bool _updateHashEntry(ListElement* hashElement, const char* value, SlabAllocator* entriesAllocator);
+static bool _isSlabAllocatedHashEntry(const HashEntry* hashEntry);
+static void _deleteHashEntry(HashEntry* hashEntry, SlabAllocator* entriesAllocator);
+static ListElement* _getMatchingKeyElement(const List* currentBucket, const HashKey* hashKey);
+static void _deleteHashEntryContent(Object* object); // custom deleter for hash table (slab entries are kept by slab)
+static ListElement* _removeElementFromBucket(const HashKey* hashKey, List* bucket);
+static List* _getCurrentBucket(const HashKey* hashKey, const HashTable* hashTable);
 
 HashTable* createHashTable(const size_t hashSize, void* elementsPool)
+{
+    return createHashTableWithAllocator(hashSize, elementsPool != NULL ? getPoolElementsAllocator() : NULL,
+                                        elementsPool);
+}
+
+HashTable* createHashTableWithAllocator(const size_t hashSize, const ListElementsAllocator* allocator,
+                                        void* allocatorContext)
 {
     HashTable* hashTable = NULL;
+    const size_t bucketsCount = _getBucketsCount(hashSize);
 
     // the offset bytes are required in order to prevent de-allocating data by deleting pointer to the first category
     // (hash table object)
-    void* data = hashSize > 0 ? malloc(HASH_OFFSET + sizeof(HashTable) + hashSize * sizeof(List)) : NULL;
-
-    if (data != NULL)
+    void* data = bucketsCount > 0 ? malloc(HASH_OFFSET + sizeof(HashTable)) : NULL;
+    ListElementsPoolProxy elementsPoolProxy;
+    initListElementsPoolProxy(&elementsPoolProxy, allocator, allocatorContext);
+    List* hashBuckets = data != NULL ? _createHashBuckets(bucketsCount, &elementsPoolProxy) : NULL;
+    SlabAllocator* entriesAllocator =
+        hashBuckets != NULL ? createSlabAllocator(sizeof(HashEntry) + HASH_ENTRY_INLINE_STORAGE_SIZE, 0) : NULL;
+
+    if (entriesAllocator != NULL)
     {
         hashTable = (HashTable*)(data + HASH_OFFSET);
-        List* hashBuckets = (List*)(hashTable + 1);
-
-        for (size_t index = 0; index < hashSize; ++index)
-        {
-            List* hashBucket = hashBuckets + index;
-            initEmptyList(hashBucket, elementsPool);
-        }
-
         hashTable->hashBuckets = hashBuckets;
-        hashTable->hashSize = hashSize;
+        hashTable->hashSize = bucketsCount;
+        hashTable->minHashSize = bucketsCount;
+        hashTable->entriesCount = 0;
+        hashTable->oldHashBuckets = NULL;
+        hashTable->oldHashSize = 0;
+        hashTable->rehashedBucketsCount = 0;
+        hashTable->maxLoadFactor = HASH_TABLE_DEFAULT_MAX_LOAD_FACTOR;
+        hashTable->shrinkingEnabled = false;
+        hashTable->elementsPoolProxy = elementsPoolProxy;
+        hashTable->entriesAllocator = entriesAllocator;
         hashTable->data = data;
     }
+    else
+    {
+        FREE(hashBuckets);
+        FREE(data);
+    }
 
     return hashTable;
 }
@@ -49,64 +94,84 @@ void deleteHashTable(HashTable* hashTable)
 {
     void* data = hashTable != NULL ? hashTable->data : NULL;
     List* hashBuckets = hashTable != NULL ? (List*)hashTable->hashBuckets : NULL;
+    List* oldHashBuckets = hashTable != NULL ? (List*)hashTable->oldHashBuckets : NULL;
+    SlabAllocator* entriesAllocator = hashTable != NULL ? (SlabAllocator*)hashTable->entriesAllocator : NULL;
+
+    ASSERT(hashTable == NULL || data != NULL && hashBuckets != NULL && entriesAllocator != NULL, "Invalid hash table!");
 
-    ASSERT(hashTable == NULL || data != NULL && hashBuckets != NULL, "Invalid hash table!");
+    if (oldHashBuckets != NULL)
+    {
+        for (size_t hashIndex = hashTable->rehashedBucketsCount; hashIndex < hashTable->oldHashSize; ++hashIndex)
+        {
+            clearList(oldHashBuckets + hashIndex, _deleteHashEntryContent);
+        }
+
+        FREE(oldHashBuckets);
+    }
 
     if (hashBuckets != NULL)
     {
         for (size_t hashIndex = 0; hashIndex < hashTable->hashSize; ++hashIndex)
         {
-            clearList(hashBuckets + hashIndex, _deleteHashEntry);
+            clearList(hashBuckets + hashIndex, _deleteHashEntryContent);
         }
 
-        hashBuckets = NULL;
+        FREE(hashBuckets);
     }
 
+    // all entry records are released in one go
+    deleteSlabAllocator(entriesAllocator);
+    entriesAllocator = NULL;
+
     FREE(data);
 }
 
 bool insertHashEntry(const char* key, const char* value, HashTable* hashTable)
+{
+    return insertHashEntryN(key, key != NULL ? strlen(key) : 0, value, hashTable);
+}
+
+bool insertHashEntryN(const char* key, size_t keyLength, const char* value, HashTable* hashTable)
 {
     bool success = false;
-    HashEntry* hashEntry = NULL;
-    List* currentBucket = NULL;
+    HashKey hashKey;
 
-    if (key != NULL && value != NULL && hashTable != NULL && strlen(key) > 0 && strlen(value) > 0)
+    if (value != NULL && value[0] != '\0' && hashTable != NULL && _createHashKeyN(key, keyLength, &hashKey))
     {
-        currentBucket = _getCurrentBucket(key, hashTable);
-        hashEntry = _getMatchingKeyHashEntry(currentBucket, key);
-    }
+        _rehashHashBuckets(hashTable, HASH_TABLE_REHASHED_BUCKETS_PER_STEP);
 
-    if (hashEntry != NULL)
-    {
-        if (strcmp(hashEntry->value, value) != 0)
-        {
-            success = _updateHashEntry(hashEntry, value);
-        }
-    }
-    else
-    {
-        hashEntry = _createHashEntry(key, value);
+        List* currentBucket = _getCurrentBucket(&hashKey, hashTable);
+        ListElement* matchingElement = _getMatchingKeyElement(currentBucket, &hashKey);
 
-        if (hashEntry != NULL)
+        if (matchingElement != NULL)
         {
-            ListElement* newElement =
-                createAndAppendToList(currentBucket, 0); // all hash elements have priority 0 by default
-
-            if (newElement != NULL)
+            if (strcmp(((const HashEntry*)matchingElement->object.payload)->value, value) != 0)
             {
-                assignObjectContentToListElement(newElement, hashEntryType, hashEntry);
-                success = true;
+                success = _updateHashEntry(matchingElement, value, (SlabAllocator*)hashTable->entriesAllocator);
             }
-            else
+        }
+        else
+        {
+            HashEntry* hashEntry = _createHashEntry(&hashKey, value, (SlabAllocator*)hashTable->entriesAllocator);
+
+            if (hashEntry != NULL)
             {
-                ASSERT(hashEntry->key && hashEntry->value, "Invalid hash entry!");
+                ListElement* newElement =
+                    createAndAppendToList(currentBucket, 0); // all hash elements have priority 0 by default
 
-                FREE(hashEntry->key);
-                FREE(hashEntry->value);
+                if (newElement != NULL)
+                {
+                    assignObjectContentToListElement(newElement, hashEntryType, hashEntry);
+                    ++hashTable->entriesCount;
+                    success = true;
 
-                free(hashEntry);
-                hashEntry = NULL;
+                    _adjustHashTableSize(hashTable); // failing to grow is not an error (the table remains usable)
+                }
+                else
+                {
+                    _deleteHashEntry(hashEntry, (SlabAllocator*)hashTable->entriesAllocator);
+                    hashEntry = NULL;
+                }
             }
         }
     }
@@ -116,83 +181,171 @@ bool insertHashEntry(const char* key, const char* value, HashTable* hashTable)
 
 void eraseHashEntry(const char* key, HashTable* hashTable)
 {
-    List* currentBucket = _getCurrentBucket(key, hashTable);
-    ListElement* removedElement = NULL;
+    eraseHashEntryN(key, key != NULL ? strlen(key) : 0, hashTable);
+}
 
-    ASSERT(currentBucket != NULL, "NULL bucket detected in hash table");
+void eraseHashEntryN(const char* key, size_t keyLength, HashTable* hashTable)
+{
+    List* currentBucket = NULL;
+    ListElement* removedElement = NULL;
+    HashKey hashKey;
 
-    if (currentBucket != NULL)
+    if (hashTable != NULL && _createHashKeyN(key, keyLength, &hashKey))
     {
-        removedElement = _removeElementFromBucket(key, currentBucket);
+        _rehashHashBuckets(hashTable, HASH_TABLE_REHASHED_BUCKETS_PER_STEP);
+        currentBucket = _getCurrentBucket(&hashKey, hashTable);
+
+        ASSERT(currentBucket != NULL, "NULL bucket detected in hash table");
+
+        removedElement = _removeElementFromBucket(&hashKey, currentBucket);
     }
 
     if (removedElement != NULL)
     {
-        _deleteHashEntry(&(removedElement->object));
-
-        if (currentBucket->elementsPoolProxy.elementsPool != NULL)
-        {
-            releaseListElement(removedElement, &currentBucket->elementsPoolProxy);
-        }
-        else
-        {
-            free(removedElement);
-        }
+        HashEntry* removedHashEntry = (HashEntry*)removedElement->object.payload;
+        removedElement->object.type = -1;
+        removedElement->object.payload = NULL;
+        _deleteHashEntry(removedHashEntry, (SlabAllocator*)hashTable->entriesAllocator);
 
+        releaseListElement(removedElement, &currentBucket->elementsPoolProxy);
         removedElement = NULL;
+
+        --hashTable->entriesCount;
+        _adjustHashTableSize(hashTable);
     }
 }
 
-const char* getHashEntryValue(const char* key, const HashTable* hashTable)
+bool setHashTableMaxLoadFactor(HashTable* hashTable, double maxLoadFactor, bool shrinkingEnabled)
 {
-    char* result = NULL;
+    bool success = false;
 
-    if (key != NULL && strlen(key) != 0 && hashTable != NULL)
+    if (hashTable != NULL && maxLoadFactor >= 0.0)
     {
-        List* currentBucket = NULL;
+        hashTable->maxLoadFactor = maxLoadFactor;
+        hashTable->shrinkingEnabled = shrinkingEnabled;
+        _adjustHashTableSize(hashTable);
+        success = true;
+    }
 
-        if (hashTable->hashSize > 0 && hashTable->hashBuckets != NULL)
-        {
-            size_t hashIndex;
-            _retrieveHashIndex(key, &hashIndex, hashTable->hashSize);
-            List* hashBuckets = (List*)hashTable->hashBuckets;
-            currentBucket = &hashBuckets[hashIndex];
-        }
-        else
+    return success;
+}
+
+bool reserveHashTable(HashTable* hashTable, size_t entriesCount)
+{
+    bool success = false;
+
+    if (hashTable != NULL)
+    {
+        const double requiredHashSize =
+            hashTable->maxLoadFactor > 0.0 ? (double)entriesCount / hashTable->maxLoadFactor : (double)entriesCount;
+        const size_t reservedHashSize =
+            requiredHashSize < (double)(SIZE_MAX / 2) ? _getBucketsCount((size_t)requiredHashSize + 1) : 0;
+
+        if (reservedHashSize > 0)
         {
-            ASSERT(false, "Invalid hash table");
+            success = reservedHashSize <= hashTable->hashSize || _resizeHashTable(hashTable, reservedHashSize);
+
+            if (success && reservedHashSize > hashTable->minHashSize)
+            {
+                hashTable->minHashSize = reservedHashSize;
+            }
         }
+    }
+
+    return success;
+}
+
+const char* getHashEntryValue(const char* key, HashTable* hashTable)
+{
+    return getHashEntryValueN(key, key != NULL ? strlen(key) : 0, hashTable);
+}
+
+const char* getHashEntryValueN(const char* key, size_t keyLength, HashTable* hashTable)
+{
+    char* result = NULL;
+    HashKey hashKey;
 
-        HashEntry* matchingHashEntry = _getMatchingKeyHashEntry(currentBucket, key);
+    if (hashTable != NULL && _createHashKeyN(key, keyLength, &hashKey))
+    {
+        _rehashHashBuckets(hashTable, HASH_TABLE_REHASHED_BUCKETS_PER_STEP);
+
+        List* currentBucket = _getCurrentBucket(&hashKey, hashTable);
+        ListElement* matchingElement = _getMatchingKeyElement(currentBucket, &hashKey);
 
-        if (matchingHashEntry != NULL)
+        if (matchingElement != NULL)
         {
-            result = matchingHashEntry->value;
+            result = ((HashEntry*)matchingElement->object.payload)->value;
         }
     }
 
     return result;
 }
 
-size_t getHashTableEntriesCount(const HashTable* hashTable)
+size_t getHashEntryValues(const char* const* keys, size_t keysCount, const char** values, HashTable* hashTable)
 {
-    size_t hashTableEntriesCount = 0;
+    size_t foundEntriesCount = 0;
 
-    if (hashTable != NULL)
+    if (keys != NULL && values != NULL && hashTable != NULL)
     {
-        if (hashTable->hashBuckets != NULL)
+        HashKey hashKeys[HASH_TABLE_LOOKUP_BATCH_SIZE];
+        List* buckets[HASH_TABLE_LOOKUP_BATCH_SIZE]; // NULL for invalid keys
+
+        for (size_t batchStart = 0; batchStart < keysCount; batchStart += HASH_TABLE_LOOKUP_BATCH_SIZE)
         {
-            List* hashBuckets = (List*)hashTable->hashBuckets;
+            const size_t remainingKeysCount = keysCount - batchStart;
+            const size_t batchSize =
+                remainingKeysCount < HASH_TABLE_LOOKUP_BATCH_SIZE ? remainingKeysCount : HASH_TABLE_LOOKUP_BATCH_SIZE;
 
-            for (size_t hashIndex = 0; hashIndex < hashTable->hashSize; ++hashIndex)
+            // the bucket of a key depends on the rehashing progress, so the rehashing step is done first
+            _rehashHashBuckets(hashTable, HASH_TABLE_REHASHED_BUCKETS_PER_STEP);
+
+            for (size_t index = 0; index < batchSize; ++index)
             {
-                hashTableEntriesCount += getListSize(&hashBuckets[hashIndex]);
+                buckets[index] = _createHashKey(keys[batchStart + index], &hashKeys[index])
+                                     ? _getCurrentBucket(&hashKeys[index], hashTable)
+                                     : NULL;
+                PREFETCH(buckets[index]);
+            }
+
+            for (size_t index = 0; index < batchSize; ++index)
+            {
+                if (buckets[index] != NULL)
+                {
+                    PREFETCH(buckets[index]->first);
+                }
+            }
+
+            for (size_t index = 0; index < batchSize; ++index)
+            {
+                if (buckets[index] != NULL && buckets[index]->first != NULL)
+                {
+                    PREFETCH(buckets[index]->first->object.payload);
+                }
+            }
+
+            for (size_t index = 0; index < batchSize; ++index)
+            {
+                ListElement* matchingElement =
+                    buckets[index] != NULL ? _getMatchingKeyElement(buckets[index], &hashKeys[index]) : NULL;
+
+                values[batchStart + index] =
+                    matchingElement != NULL ? ((HashEntry*)matchingElement->object.payload)->value : NULL;
+                foundEntriesCount += matchingElement != NULL ? 1 : 0;
             }
         }
-        else
-        {
-            ASSERT(false, "Invalid hash buckets detected!");
-        }
+    }
+
+    return foundEntriesCount;
+}
+
+size_t getHashTableEntriesCount(const HashTable* hashTable)
+{
+    size_t hashTableEntriesCount = 0;
+
+    if (hashTable != NULL)
+    {
+        ASSERT(hashTable->hashBuckets != NULL, "Invalid hash buckets detected!");
+        hashTableEntriesCount = hashTable->entriesCount;
     }
 
     return hashTableEntriesCount;
@@ -210,6 +363,11 @@ size_t getHashIndexesCount(const HashTable* hashTable)
     return keysCount;
 }
 
+bool isHashTableRehashing(const HashTable* hashTable)
+{
+    return hashTable != NULL && hashTable->oldHashBuckets != NULL;
+}
+
 size_t getHashIndexForKey(const char* key, size_t hashSize)
 {
     size_t hashIndex;
@@ -222,91 +380,255 @@ static bool _retrieveHashIndex(const char* key, size_t* hashIndex, const size_t
 {
     bool success = false;
 
-    if (key != NULL && hashIndex != NULL && strlen(key) > 0 && hashSize > 0)
+    const size_t keyLength = key != NULL ? strlen(key) : 0;
+    const size_t bucketsCount = _getBucketsCount(hashSize);
+
+    if (hashIndex != NULL && keyLength > 0 && bucketsCount > 0)
+    {
+        *hashIndex = (size_t)(computeHash(key, keyLength) & (bucketsCount - 1));
+        success = true;
+    }
+
+    return success;
+}
+
+static bool _createHashKey(const char* key, HashKey* hashKey)
+{
+    return _createHashKeyN(key, key != NULL ? strlen(key) : 0, hashKey);
+}
+
+static bool _createHashKeyN(const char* key, size_t keyLength, HashKey* hashKey)
+{
+    bool success = false;
+
+    if (key != NULL && keyLength > 0)
     {
-        size_t sum = 0;
+        hashKey->key = key;
+        hashKey->keyLength = keyLength;
+        hashKey->keyHash = computeHash(key, keyLength);
+        success = true;
+    }
+
+    return success;
+}
+
+// the key content is only compared if the hash and length match
+static bool _isMatchingHashEntry(const HashEntry* hashEntry, const HashKey* hashKey)
+{
+    return hashEntry->keyHash == hashKey->keyHash && hashEntry->keyLength == hashKey->keyLength &&
+           memcmp(hashEntry->key, hashKey->key, hashKey->keyLength) == 0;
+}
 
-        for (size_t index = 0; index < strlen(key); ++index)
+static size_t _getBucketsCount(const size_t hashSize)
+{
+    size_t bucketsCount = hashSize > 0 ? 1 : 0;
+
+    while (bucketsCount > 0 && bucketsCount < hashSize)
+    {
+        bucketsCount <<= 1; // becomes 0 on overflow (hash size too large)
+    }
+
+    return bucketsCount;
+}
+
+static List* _createHashBuckets(const size_t bucketsCount, ListElementsPoolProxy* elementsPoolProxy)
+{
+    List* hashBuckets = bucketsCount > 0 ? (List*)malloc(bucketsCount * sizeof(List)) : NULL;
+
+    if (hashBuckets != NULL)
+    {
+        for (size_t index = 0; index < bucketsCount; ++index)
         {
-            sum = sum + (size_t)key[index];
+            initEmptyListWithAllocator(hashBuckets + index, elementsPoolProxy->allocator, elementsPoolProxy->context);
         }
+    }
 
-        *hashIndex = sum % hashSize;
+    return hashBuckets;
+}
+
+static bool _resizeHashTable(HashTable* hashTable, const size_t newHashSize)
+{
+    bool success = false;
+
+    // only two bucket arrays can be live at any time
+    _rehashHashBuckets(hashTable, SIZE_MAX);
+
+    List* newHashBuckets = _createHashBuckets(newHashSize, &hashTable->elementsPoolProxy);
+
+    if (newHashBuckets != NULL)
+    {
+        hashTable->oldHashBuckets = hashTable->hashBuckets;
+        hashTable->oldHashSize = hashTable->hashSize;
+        hashTable->rehashedBucketsCount = 0;
+        hashTable->hashBuckets = newHashBuckets;
+        hashTable->hashSize = newHashSize;
         success = true;
     }
 
     return success;
 }
 
-static HashEntry* _createHashEntry(const char* key, const char* value)
+// the list elements are moved to the new buckets, the entries remain in place
+static void _rehashHashBuckets(HashTable* hashTable, size_t bucketsCount)
 {
-    HashEntry* entry = NULL;
+    List* oldHashBuckets = (List*)hashTable->oldHashBuckets;
 
-    if (key != NULL && value != NULL && strlen(key) > 0 && strlen(value) > 0)
+    if (oldHashBuckets != NULL)
     {
-        entry = (HashEntry*)malloc(sizeof(HashEntry));
+        List* hashBuckets = (List*)hashTable->hashBuckets;
+        const size_t remainingBucketsCount = hashTable->oldHashSize - hashTable->rehashedBucketsCount;
+        const size_t stepBucketsCount = bucketsCount < remainingBucketsCount ? bucketsCount : remainingBucketsCount;
+        const size_t lastRehashedBucketIndex = hashTable->rehashedBucketsCount + stepBucketsCount;
 
-        if (entry != NULL)
+        for (; hashTable->rehashedBucketsCount < lastRehashedBucketIndex; ++hashTable->rehashedBucketsCount)
         {
-            char* entryKey = createStringCopy(key);
-            char* entryValue = NULL;
+            List* oldHashBucket = oldHashBuckets + hashTable->rehashedBucketsCount;
+            ListElement* currentElement = removeFirstListElement(oldHashBucket);
 
-            if (entryKey != NULL)
+            while (currentElement != NULL)
             {
-                entryValue = createStringCopy(value);
+                const HashEntry* currentHashEntry = (const HashEntry*)currentElement->object.payload;
+                const size_t newHashIndex = (size_t)(currentHashEntry->keyHash & (hashTable->hashSize - 1));
 
-                if (entryValue == NULL)
-                {
-                    free(entryKey);
-                    entryKey = NULL;
-                }
+                appendToList(hashBuckets + newHashIndex, currentElement);
+                currentElement = removeFirstListElement(oldHashBucket);
             }
+        }
 
-            if (entryValue != NULL)
-            {
-                ASSERT(entryKey != NULL, "Invalid key!");
+        if (hashTable->rehashedBucketsCount == hashTable->oldHashSize)
+        {
+            FREE(oldHashBuckets);
+            hashTable->oldHashBuckets = NULL;
+            hashTable->oldHashSize = 0;
+            hashTable->rehashedBucketsCount = 0;
+        }
+    }
+}
+
+// no adjustment while rehashing (the new hash size provides enough room for the current entries)
+static void _adjustHashTableSize(HashTable* hashTable)
+{
+    if (hashTable->maxLoadFactor > 0.0 && hashTable->oldHashBuckets == NULL)
+    {
+        const double loadFactor = (double)hashTable->entriesCount / (double)hashTable->hashSize;
 
-                entry->key = entryKey;
-                entry->value = entryValue;
-                entryKey = NULL;
-                entryValue = NULL;
+        if (loadFactor > hashTable->maxLoadFactor && hashTable->hashSize <= SIZE_MAX / 2)
+        {
+            size_t newHashSize = hashTable->hashSize * 2;
+
+            // a reduced max load factor might require multiple doublings
+            while ((double)hashTable->entriesCount / (double)newHashSize > hashTable->maxLoadFactor &&
+                   newHashSize <= SIZE_MAX / 2)
+            {
+                newHashSize *= 2;
             }
-            else
+
+            (void)_resizeHashTable(hashTable, newHashSize);
+        }
+        else if (hashTable->shrinkingEnabled && hashTable->hashSize > hashTable->minHashSize &&
+                 loadFactor < hashTable->maxLoadFactor / 4)
+        {
+            size_t newHashSize = hashTable->hashSize / 2;
+
+            while (newHashSize > hashTable->minHashSize &&
+                   (double)hashTable->entriesCount / (double)newHashSize < hashTable->maxLoadFactor / 4)
             {
-                free(entry);
-                entry = NULL;
+                newHashSize /= 2;
             }
+
+            (void)_resizeHashTable(hashTable, newHashSize);
+        }
+    }
+}
+
+// key and value are stored right after the entry header (one allocation)
+static HashEntry* _createHashEntry(const HashKey* hashKey, const char* value, SlabAllocator* entriesAllocator)
+{
+    HashEntry* entry = NULL;
+
+    if (hashKey != NULL && value != NULL && value[0] != '\0')
+    {
+        const size_t valueLength = strlen(value);
+        const size_t storageSize = hashKey->keyLength + valueLength + 2;
+        const bool isSlabAllocated = storageSize <= HASH_ENTRY_INLINE_STORAGE_SIZE;
+
+        entry = isSlabAllocated ? (HashEntry*)allocateSlabObject(entriesAllocator)
+                                : (HashEntry*)malloc(sizeof(HashEntry) + storageSize);
+
+        if (entry != NULL)
+        {
+            entry->key = (char*)(entry + 1);
+            entry->value = entry->key + hashKey->keyLength + 1;
+            entry->keyHash = hashKey->keyHash;
+            entry->keyLength = hashKey->keyLength;
+
+            // the slab entries use all the inline storage left after the key
+            entry->valueCapacity =
+                isSlabAllocated ? HASH_ENTRY_INLINE_STORAGE_SIZE - hashKey->keyLength - 2 : valueLength;
+
+            // the searched key is not necessarily terminated (e.g. when located inside a larger buffer)
+            memcpy(entry->key, hashKey->key, hashKey->keyLength);
+            entry->key[hashKey->keyLength] = '\0';
+            memcpy(entry->value, value, valueLength + 1);
         }
     }
 
     return entry;
 }
 
-static bool _updateHashEntry(HashEntry* hashEntry, const char* value)
+static bool _updateHashEntry(ListElement* hashElement, const char* value, SlabAllocator* entriesAllocator)
 {
     bool success = false;
 
-    if (hashEntry != NULL && value != NULL)
+    if (hashElement != NULL && value != NULL)
     {
-        char* newValue = createStringCopy(value);
+        HashEntry* hashEntry = (HashEntry*)hashElement->object.payload;
+        const size_t valueLength = strlen(value);
 
-        if (newValue != NULL)
+        if (valueLength <= hashEntry->valueCapacity)
         {
-            free(hashEntry->value);
-            hashEntry->value = newValue;
-            newValue = NULL;
+            memcpy(hashEntry->value, value, valueLength + 1);
             success = true;
         }
+        else
+        {
+            const HashKey hashKey = {hashEntry->key, hashEntry->keyLength, hashEntry->keyHash};
+            HashEntry* newHashEntry = _createHashEntry(&hashKey, value, entriesAllocator);
+
+            if (newHashEntry != NULL)
+            {
+                _deleteHashEntry(hashEntry, entriesAllocator);
+                hashElement->object.payload = newHashEntry;
+                success = true;
+            }
+        }
     }
 
     return success;
 }
 
-static HashEntry* _getMatchingKeyHashEntry(const List* currentBucket, const char* key)
+static bool _isSlabAllocatedHashEntry(const HashEntry* hashEntry)
+{
+    return hashEntry->keyLength + hashEntry->valueCapacity + 2 <= HASH_ENTRY_INLINE_STORAGE_SIZE;
+}
+
+static void _deleteHashEntry(HashEntry* hashEntry, SlabAllocator* entriesAllocator)
+{
+    if (_isSlabAllocatedHashEntry(hashEntry))
+    {
+        freeSlabObject(entriesAllocator, hashEntry);
+    }
+    else
+    {
+        free(hashEntry);
+    }
+}
+
+static ListElement* _getMatchingKeyElement(const List* currentBucket, const HashKey* hashKey)
 {
-    HashEntry* matchingKeyHashEntry = NULL;
+    ListElement* matchingKeyElement = NULL;
 
-    if (currentBucket != NULL && key != NULL && strlen(key) != 0)
+    if (currentBucket != NULL && hashKey != NULL)
     {
         ListElement* currentBucketEntry = getFirstListElement(currentBucket);
 
@@ -320,16 +642,11 @@ static HashEntry* _getMatchingKeyHashEntry(const List* currentBucket, const char
 
             HashEntry* currentHashEntry = (HashEntry*)(currentBucketEntry->object.payload);
 
-            if (currentHashEntry->key == NULL || currentHashEntry->value == NULL ||
-                strlen(currentHashEntry->key) == 0 || strlen(currentHashEntry->value) == 0)
-            {
-                ASSERT(false, "Invalid key-value pair");
-                break;
-            }
+            ASSERT(currentHashEntry->key != NULL && currentHashEntry->value != NULL, "Invalid key-value pair");
 
-            if (strcmp(currentHashEntry->key, key) == 0)
+            if (_isMatchingHashEntry(currentHashEntry, hashKey))
             {
-                matchingKeyHashEntry = currentHashEntry;
+                matchingKeyElement = currentBucketEntry;
                 break;
             }
 
@@ -337,22 +654,24 @@ static HashEntry* _getMatchingKeyHashEntry(const List* currentBucket, const char
         }
     }
 
-    return matchingKeyHashEntry;
+    return matchingKeyElement;
 }
 
-static void _deleteHashEntry(Object* object)
+static void _deleteHashEntryContent(Object* object)
 {
     if (object != NULL)
     {
         if (object->payload != NULL && object->type == hashEntryType)
         {
             HashEntry* entry = (HashEntry*)object->payload;
-            free(entry->key);
-            entry->key = NULL;
-            free(entry->value);
-            entry->value = NULL;
+
+            // the slab entries are released together with the slab allocator
+            if (!_isSlabAllocatedHashEntry(entry))
+            {
+                free(entry);
+            }
+
             object->type = -1;
-            free(object->payload);
             object->payload = NULL;
         }
         else
@@ -362,7 +681,7 @@ static void _deleteHashEntry(Object* object)
     }
 }
 
-static ListElement* _removeElementFromBucket(const char* key, List* bucket)
+static ListElement* _removeElementFromBucket(const HashKey* hashKey, List* bucket)
 {
     ListElement* removedElement = NULL;
 
@@ -383,7 +702,7 @@ static ListElement* _removeElementFromBucket(const char* key, List* bucket)
 
             HashEntry* currentHashEntry = (HashEntry*)(it.current->object.payload);
 
-            if (strcmp(currentHashEntry->key, key) == 0)
+            if (_isMatchingHashEntry(currentHashEntry, hashKey))
             {
                 removedElement = removeCurrentListElement(it);
                 break;
@@ -396,18 +715,26 @@ static ListElement* _removeElementFromBucket(const char* key, List* bucket)
     return removedElement;
 }
 
-static List* _getCurrentBucket(const char* key, HashTable* hashTable)
+// while rehashing, the keys belonging to old buckets that have not been rehashed yet are located in these buckets
+static List* _getCurrentBucket(const HashKey* hashKey, const HashTable* hashTable)
 {
     List* currentBucket = NULL;
 
-    if (key != NULL && strlen(key) > 0 && hashTable != NULL)
+    if (hashKey != NULL && hashTable != NULL)
     {
         if (hashTable->hashSize > 0 && hashTable->hashBuckets != NULL)
         {
-            size_t hashIndex;
-            _retrieveHashIndex(key, &hashIndex, hashTable->hashSize);
-            List* hashBuckets = (List*)hashTable->hashBuckets;
-            currentBucket = &hashBuckets[hashIndex];
+            const uint64_t keyHash = hashKey->keyHash;
+            const size_t oldHashIndex = (size_t)(keyHash & (hashTable->oldHashSize - 1));
+
+            if (hashTable->oldHashBuckets != NULL && oldHashIndex >= hashTable->rehashedBucketsCount)
+            {
+                currentBucket = (List*)hashTable->oldHashBuckets + oldHashIndex;
+            }
+            else
+            {
+                currentBucket = (List*)hashTable->hashBuckets + (size_t)(keyHash & (hashTable->hashSize - 1));
+            }
         }
         else
         {
@@ -1,36 +1,97 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "listelementspoolproxy.h"
+
+#define HASH_ENTRY_INLINE_STORAGE_SIZE 48 // key and value bytes (terminators included) of the slab allocated entries
+
+/* Each hash entry is a single memory block: the header (HashEntry) followed by the key and value bytes
+   - the entries whose key and value fit into HASH_ENTRY_INLINE_STORAGE_SIZE bytes are provided by the slab allocator
+   of the hash table, the others are individually allocated
+   - an updated value is written in place if it fits into the value capacity, otherwise the entry gets re-created
+*/
 typedef struct
 {
-    char* key;
-    char* value;
+    char* key;        // points right after the header
+    char* value;      // points right after the key
+    uint64_t keyHash; // compared (together with the key length) prior to comparing the key content
+    size_t keyLength;
+    size_t valueCapacity; // maximum value length that can be written in place
 } HashEntry;
 
+#define HASH_TABLE_DEFAULT_MAX_LOAD_FACTOR 1.0
+#define HASH_TABLE_REHASHED_BUCKETS_PER_STEP 4
+#define HASH_TABLE_LOOKUP_BATCH_SIZE 16 // keys whose memory accesses are overlapped by getHashEntryValues()
+
 typedef struct
 {
     void* hashBuckets;
     size_t hashSize;
-    void* data; // to be used for HashTable deletion only
+    size_t minHashSize; // the hash table is never shrunk below this size
+    size_t entriesCount;
+    double maxLoadFactor;
+    bool shrinkingEnabled;
+    void* oldHashBuckets;                    // buckets still being rehashed (NULL if no rehashing in progress)
+    size_t oldHashSize;
+    size_t rehashedBucketsCount;             // the old buckets below this index have already been rehashed
+    ListElementsPoolProxy elementsPoolProxy; // provides the elements of the (re-)created buckets
+    void* entriesAllocator;                  // slab allocator providing the short hash entries
+    void* data;                              // to be used for HashTable deletion only
 } HashTable;
 
+/* The keys are hashed with a strong hash function (see computeHash()) and the bucket is selected by masking the hash
+   - the requested hash size is rounded up to the next power of two (getHashIndexesCount() returns the actual size)
+   - the hash size is doubled when the load factor (entries count / hash size) exceeds the maximum load factor
+   - if shrinking is enabled, the hash size is halved when the load factor drops below a quarter of the maximum (but
+   not below the initial or reserved size)
+   - on resize the bucket elements are re-linked into the new buckets (no entry or list element gets re-allocated)
+   - the re-linking is incremental in order to avoid latency spikes: both bucket arrays are kept and each insert, erase
+   or lookup rehashes the next HASH_TABLE_REHASHED_BUCKETS_PER_STEP old buckets; a key is located in the old bucket
+   array as long as its old bucket has not been rehashed yet and in the new one afterwards
+   - a resize requested (e.g. by reserving) while rehashing completes the pending rehash first
+*/
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
     HashTable* createHashTable(const size_t hashSize, void* elementsPool);
+    HashTable* createHashTableWithAllocator(const size_t hashSize, const ListElementsAllocator* allocator,
+                                            void* allocatorContext);
     void deleteHashTable(HashTable* hashTable);
+
+    // max load factor 0: no automatic resizing
+    bool setHashTableMaxLoadFactor(HashTable* hashTable, double maxLoadFactor, bool shrinkingEnabled);
+    bool reserveHashTable(HashTable* hashTable, size_t entriesCount); // minimum hash size raised accordingly
     bool insertHashEntry(const char* key, const char* value, HashTable* hashTable);
     void eraseHashEntry(const char* key, HashTable* hashTable);
 
-    const char* getHashEntryValue(const char* key, const HashTable* hashTable);
+    const char* getHashEntryValue(const char* key, HashTable* hashTable); // the table might get (partially) rehashed
+
+    /* Same as the above functions, except the key is given by its first char and length (it doesn't need to be
+       terminated), so keys located inside larger buffers (e.g. network receive buffers) can be used without copying
+       - the key chars should not contain the terminating char ('\0')
+    */
+    bool insertHashEntryN(const char* key, size_t keyLength, const char* value, HashTable* hashTable);
+    void eraseHashEntryN(const char* key, size_t keyLength, HashTable* hashTable);
+    const char* getHashEntryValueN(const char* key, size_t keyLength, HashTable* hashTable);
+
+    /* Looks up multiple keys, returns the number of found entries (values[index] is NULL if keys[index] is not found)
+       - the keys are processed in batches: first all hashes are computed and the buckets prefetched, then the first
+       bucket elements and their entries are prefetched and finally the lookups are resolved, so the cache misses of
+       the batch keys overlap instead of stalling one lookup after the other
+       - one rehashing step (if rehashing is in progress) is performed per batch
+    */
+    size_t getHashEntryValues(const char* const* keys, size_t keysCount, const char** values, HashTable* hashTable);
     size_t getHashTableEntriesCount(const HashTable* hashTable);
-    size_t getHashIndexesCount(const HashTable* hashTable);
+    size_t getHashIndexesCount(const HashTable* hashTable); // for a table being rehashed: the new hash size
+    bool isHashTableRehashing(const HashTable* hashTable);
 
-    // for testing purposes only
+    // for testing purposes only (same power of two rounding of the hash size as for the hash table)
     size_t getHashIndexForKey(const char* key, size_t hashSize);
 
 #ifdef __cplusplus
@@ -0,0 +1,250 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "codeutils.h"
+#include "error.h"
+#include "inthashmap.h"
+
+#define INT_HASH_MAP_OFFSET 4
+
+#define FIBONACCI_HASH_MULTIPLIER 11400714819323198485ull // 2^64 / golden ratio
+
+typedef struct
+{
+    size_t key;
+    void* value; // NULL for empty slots
+} IntHashSlot;
+
+// "private" (supporting) functions
+static size_t _getIntHashCapacity(const size_t requestedCapacity, size_t* hashShift);
+static size_t _getMaxEntriesCount(const size_t capacity);
+static size_t _getHomeSlotIndex(size_t key, size_t hashShift);
+static bool _findIntHashSlot(const IntHashMap* hashMap, size_t key, size_t* slotIndex);
+static bool _resizeIntHashMap(IntHashMap* hashMap, const size_t newCapacity);
+
+IntHashMap* createIntHashMap(const size_t capacity)
+{
+    IntHashMap* hashMap = NULL;
+    size_t hashShift;
+    const size_t actualCapacity = _getIntHashCapacity(capacity, &hashShift);
+
+    // the offset bytes are required in order to prevent de-allocating data by deleting pointer to the first category
+    // (hash map object)
+    void* data = actualCapacity > 0 ? malloc(INT_HASH_MAP_OFFSET + sizeof(IntHashMap)) : NULL;
+    IntHashSlot* slots = data != NULL ? (IntHashSlot*)calloc(actualCapacity, sizeof(IntHashSlot)) : NULL;
+
+    if (slots != NULL)
+    {
+        hashMap = (IntHashMap*)(data + INT_HASH_MAP_OFFSET);
+        hashMap->entrySlots = slots;
+        hashMap->capacity = actualCapacity;
+        hashMap->hashShift = hashShift;
+        hashMap->entriesCount = 0;
+        hashMap->data = data;
+    }
+    else
+    {
+        FREE(data);
+    }
+
+    return hashMap;
+}
+
+void deleteIntHashMap(IntHashMap* hashMap)
+{
+    void* data = hashMap != NULL ? hashMap->data : NULL;
+    void* slots = hashMap != NULL ? hashMap->entrySlots : NULL;
+
+    ASSERT(hashMap == NULL || data != NULL && slots != NULL, "Invalid hash map!");
+
+    FREE(slots);
+    FREE(data);
+}
+
+bool insertIntHashEntry(size_t key, void* value, IntHashMap* hashMap)
+{
+    bool success = false;
+
+    if (value != NULL && hashMap != NULL)
+    {
+        IntHashSlot* slots = (IntHashSlot*)hashMap->entrySlots;
+        size_t slotIndex;
+
+        if (_findIntHashSlot(hashMap, key, &slotIndex))
+        {
+            if (slots[slotIndex].value != value)
+            {
+                slots[slotIndex].value = value;
+                success = true;
+            }
+        }
+        else
+        {
+            if (hashMap->entriesCount == _getMaxEntriesCount(hashMap->capacity))
+            {
+                (void)_resizeIntHashMap(hashMap, hashMap->capacity * 2);
+            }
+
+            if (hashMap->entriesCount < _getMaxEntriesCount(hashMap->capacity))
+            {
+                const size_t slotsMask = hashMap->capacity - 1;
+                slots = (IntHashSlot*)hashMap->entrySlots;
+                slotIndex = _getHomeSlotIndex(key, hashMap->hashShift);
+
+                while (slots[slotIndex].value != NULL)
+                {
+                    slotIndex = (slotIndex + 1) & slotsMask;
+                }
+
+                slots[slotIndex].key = key;
+                slots[slotIndex].value = value;
+                ++hashMap->entriesCount;
+                success = true;
+            }
+        }
+    }
+
+    return success;
+}
+
+/* Backward shift deletion: the entries following the erased one (up to the first empty slot) are moved back if their
+   home slot is not located between the emptied slot and their current slot
+*/
+void eraseIntHashEntry(size_t key, IntHashMap* hashMap)
+{
+    size_t emptySlotIndex;
+
+    if (hashMap != NULL && _findIntHashSlot(hashMap, key, &emptySlotIndex))
+    {
+        IntHashSlot* slots = (IntHashSlot*)hashMap->entrySlots;
+        const size_t slotsMask = hashMap->capacity - 1;
+        size_t slotIndex = (emptySlotIndex + 1) & slotsMask;
+
+        while (slots[slotIndex].value != NULL)
+        {
+            const size_t homeSlotIndex = _getHomeSlotIndex(slots[slotIndex].key, hashMap->hashShift);
+
+            if (((slotIndex - homeSlotIndex) & slotsMask) >= ((slotIndex - emptySlotIndex) & slotsMask))
+            {
+                slots[emptySlotIndex] = slots[slotIndex];
+                emptySlotIndex = slotIndex;
+            }
+
+            slotIndex = (slotIndex + 1) & slotsMask;
+        }
+
+        slots[emptySlotIndex].value = NULL;
+        --hashMap->entriesCount;
+    }
+}
+
+void* getIntHashEntryValue(size_t key, const IntHashMap* hashMap)
+{
+    void* result = NULL;
+    size_t slotIndex;
+
+    if (hashMap != NULL && _findIntHashSlot(hashMap, key, &slotIndex))
+    {
+        result = ((const IntHashSlot*)hashMap->entrySlots)[slotIndex].value;
+    }
+
+    return result;
+}
+
+size_t getIntHashMapEntriesCount(const IntHashMap* hashMap)
+{
+    return hashMap != NULL ? hashMap->entriesCount : 0;
+}
+
+size_t getIntHashMapCapacity(const IntHashMap* hashMap)
+{
+    return hashMap != NULL ? hashMap->capacity : 0;
+}
+
+static size_t _getIntHashCapacity(const size_t requestedCapacity, size_t* hashShift)
+{
+    ASSERT(hashShift != NULL, "Null pointer argument detected");
+
+    size_t capacity = INT_HASH_MAP_MIN_CAPACITY;
+    *hashShift = 64 - 3; // log2(INT_HASH_MAP_MIN_CAPACITY) bits used for the slot index
+
+    while (capacity > 0 && capacity < requestedCapacity)
+    {
+        capacity = capacity <= SIZE_MAX / (2 * sizeof(IntHashSlot)) ? capacity << 1 : 0;
+        --*hashShift;
+    }
+
+    return capacity;
+}
+
+static size_t _getMaxEntriesCount(const size_t capacity)
+{
+    return capacity - capacity / 4;
+}
+
+static size_t _getHomeSlotIndex(size_t key, size_t hashShift)
+{
+    return (size_t)(((uint64_t)key * FIBONACCI_HASH_MULTIPLIER) >> hashShift);
+}
+
+static bool _findIntHashSlot(const IntHashMap* hashMap, size_t key, size_t* slotIndex)
+{
+    bool found = false;
+    const IntHashSlot* slots = (const IntHashSlot*)hashMap->entrySlots;
+    const size_t slotsMask = hashMap->capacity - 1;
+    size_t currentSlotIndex = _getHomeSlotIndex(key, hashMap->hashShift);
+
+    // the map always has empty slots (max load factor below 1), so the probing ends
+    while (slots[currentSlotIndex].value != NULL)
+    {
+        if (slots[currentSlotIndex].key == key)
+        {
+            *slotIndex = currentSlotIndex;
+            found = true;
+            break;
+        }
+
+        currentSlotIndex = (currentSlotIndex + 1) & slotsMask;
+    }
+
+    return found;
+}
+
+static bool _resizeIntHashMap(IntHashMap* hashMap, const size_t newCapacity)
+{
+    bool success = false;
+    size_t newHashShift;
+    const size_t actualCapacity = _getIntHashCapacity(newCapacity, &newHashShift);
+    IntHashSlot* newSlots = actualCapacity > 0 ? (IntHashSlot*)calloc(actualCapacity, sizeof(IntHashSlot)) : NULL;
+
+    if (newSlots != NULL)
+    {
+        IntHashSlot* slots = (IntHashSlot*)hashMap->entrySlots;
+        const size_t capacity = hashMap->capacity;
+        const size_t newSlotsMask = actualCapacity - 1;
+
+        for (size_t slotIndex = 0; slotIndex < capacity; ++slotIndex)
+        {
+            if (slots[slotIndex].value != NULL)
+            {
+                size_t newSlotIndex = _getHomeSlotIndex(slots[slotIndex].key, newHashShift);
+
+                while (newSlots[newSlotIndex].value != NULL)
+                {
+                    newSlotIndex = (newSlotIndex + 1) & newSlotsMask;
+                }
+
+                newSlots[newSlotIndex] = slots[slotIndex];
+            }
+        }
+
+        free(slots);
+        hashMap->entrySlots = newSlots;
+        hashMap->capacity = actualCapacity;
+        hashMap->hashShift = newHashShift;
+        success = true;
+    }
+
+    return success;
+}
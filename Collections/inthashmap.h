@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Hash map with integer (size_t) keys, an alternative to the HashTable for numeric IDs
+   - no key formatting/copying and no string comparisons: the keys are stored inline in the slots array, next to the
+   values (key/value pairs)
+   - the slot index is given by fibonacci (multiplicative) hashing: the upper bits of the key multiplied by 2^64/phi
+   - linear probing; the capacity is a power of two (min: INT_HASH_MAP_MIN_CAPACITY) and the map grows (doubles) when
+   more than 3/4 of the slots are used
+   - erased entries don't leave deleted slots behind: the following entries of the probe sequence are shifted back
+   - the values are not owned by the map (never freed by it) and NULL values are not allowed (mark the empty slots)
+   - the entries semantics (insert/update/erase/lookup) are the same as for the HashTable
+*/
+
+#define INT_HASH_MAP_MIN_CAPACITY 8
+
+typedef struct
+{
+    void* entrySlots; // key/value pairs
+    size_t capacity;
+    size_t hashShift; // the slot index is given by the (64 - hashShift) upper bits of the hash
+    size_t entriesCount;
+    void* data; // to be used for IntHashMap deletion only
+} IntHashMap;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    IntHashMap* createIntHashMap(const size_t capacity); // rounded up to a power of two
+    void deleteIntHashMap(IntHashMap* hashMap);          // the values should be deleted by the user (if required)
+    bool insertIntHashEntry(size_t key, void* value, IntHashMap* hashMap);
+    void eraseIntHashEntry(size_t key, IntHashMap* hashMap);
+
+    void* getIntHashEntryValue(size_t key, const IntHashMap* hashMap);
+    size_t getIntHashMapEntriesCount(const IntHashMap* hashMap);
+    size_t getIntHashMapCapacity(const IntHashMap* hashMap);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,8 +5,14 @@
 #include <stdio.h>
 
 #define QUEUE_OFFSET 4
+#define QUEUE_RECYCLE_CACHE_CAPACITY 16 // insert/remove churn re-uses the recently removed elements
 
 PriorityQueue* createPriorityQueue(void* elementsPool)
+{
+    return createPriorityQueueWithAllocator(elementsPool != NULL ? getPoolElementsAllocator() : NULL, elementsPool);
+}
+
+PriorityQueue* createPriorityQueueWithAllocator(const ListElementsAllocator* allocator, void* allocatorContext)
 {
     PriorityQueue* queue = NULL;
 
@@ -20,7 +26,8 @@ PriorityQueue* createPriorityQueue(void* elementsPool)
 
         List* queueContainer = (List*)(queue + 1);
 
-        initEmptyList(queueContainer, elementsPool);
+        initEmptyListWithAllocator(queueContainer, allocator, allocatorContext);
+        setListRecycleCacheCapacity(queueContainer, QUEUE_RECYCLE_CACHE_CAPACITY);
         queue->container = queueContainer;
         queue->data = data;
     }
@@ -60,9 +67,7 @@ bool insertIntoPriorityQueue(PriorityQueue* queue, const Priority priority, cons
 
         if (queueContainer != NULL)
         {
-            newElement = queueContainer->elementsPoolProxy.elementsPool != NULL
-                             ? aquireListElement(&queueContainer->elementsPoolProxy)
-                             : createListElement();
+            newElement = aquireListElementForList(queueContainer);
         }
 
         if (newElement != NULL)
@@ -129,9 +134,9 @@ Object* removeFromPriorityQueue(PriorityQueue* queue)
         {
             Object* newObject = NULL;
 
-            if (removedElement->object.type >= 0 && removedElement->object.payload != NULL)
+            if (!isEmptyObject(&removedElement->object))
             {
-                newObject = createObject(removedElement->object.type, removedElement->object.payload);
+                newObject = (Object*)malloc(sizeof(Object));
             }
             else
             {
@@ -142,19 +147,12 @@ Object* removeFromPriorityQueue(PriorityQueue* queue)
             // element
             if (newObject != NULL)
             {
+                *newObject = removedElement->object; // inline payload included
                 result = newObject;
                 removedElement->object.type = -1;
                 removedElement->object.payload = NULL;
 
-                if (queueContainer->elementsPoolProxy.elementsPool != NULL)
-                {
-                    releaseListElement(removedElement, &queueContainer->elementsPoolProxy);
-                }
-                else
-                {
-                    free(removedElement);
-                }
-
+                recycleListElement(queueContainer, removedElement);
                 removedElement = NULL;
             }
         }
@@ -236,7 +234,7 @@ Object* getPriorityQueueObject(PriorityQueueIterator it)
 
     // every queue object must be valid; we must ensure this throughout the usage period of the queue (user can modify
     // objects by using the priority queue iterator)
-    ASSERT(object != NULL && object->payload != NULL, "Invalid queue element object detected");
+    ASSERT(!isEmptyObject(object), "Invalid queue element object detected");
 
     return object;
 }
@@ -257,7 +255,7 @@ Priority getObjectPriority(PriorityQueueIterator it)
     Priority priority = 0;
 
     // we must still ensure the object is valid even if only the priority is requested
-    if (object != NULL && object->payload != NULL)
+    if (!isEmptyObject(object))
     {
         priority = ((ListElement*)(it.queueItem))->priority;
     }
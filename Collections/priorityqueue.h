@@ -2,6 +2,7 @@
 
 #include "codeutils.h"
 #include "listelement.h"
+#include "listelementspoolproxy.h"
 
 typedef struct
 {
@@ -21,6 +22,7 @@ extern "C"
 #endif
 
     PriorityQueue* createPriorityQueue(void* elementsPool);
+    PriorityQueue* createPriorityQueueWithAllocator(const ListElementsAllocator* allocator, void* allocatorContext);
     void deletePriorityQueue(PriorityQueue* queue, void (*deallocObject)(Object* object));
 
     bool insertIntoPriorityQueue(PriorityQueue* queue, const size_t priority, const int objectType,
@@ -5,8 +5,14 @@
 #include <stdio.h>
 
 #define STACK_OFFSET 4
+#define STACK_RECYCLE_CACHE_CAPACITY 16 // push/pop churn re-uses the recently popped elements
 
 Stack* createStack(void* elementsPool)
+{
+    return createStackWithAllocator(elementsPool != NULL ? getPoolElementsAllocator() : NULL, elementsPool);
+}
+
+Stack* createStackWithAllocator(const ListElementsAllocator* allocator, void* allocatorContext)
 {
     Stack* stack = NULL;
 
@@ -20,7 +26,8 @@ Stack* createStack(void* elementsPool)
 
         List* stackContainer = (List*)(stack + 1);
 
-        initEmptyList(stackContainer, elementsPool);
+        initEmptyListWithAllocator(stackContainer, allocator, allocatorContext);
+        setListRecycleCacheCapacity(stackContainer, STACK_RECYCLE_CACHE_CAPACITY);
         stack->container = stackContainer;
         stack->data = data;
     }
@@ -89,9 +96,9 @@ Object* popFromStack(Stack* stack)
         {
             Object* newObject = NULL;
 
-            if (topStackElement->object.type >= 0 && topStackElement->object.payload != NULL)
+            if (!isEmptyObject(&topStackElement->object))
             {
-                newObject = createObject(topStackElement->object.type, topStackElement->object.payload);
+                newObject = (Object*)malloc(sizeof(Object)); // content copied below (inline payload included)
             }
             else
             {
@@ -102,16 +109,10 @@ Object* popFromStack(Stack* stack)
             {
                 *newObject = topStackElement->object;
                 result = newObject;
+                topStackElement->object.type = -1;
+                topStackElement->object.payload = NULL;
 
-                if (stackContainer->elementsPoolProxy.elementsPool != NULL)
-                {
-                    releaseListElement(topStackElement, &stackContainer->elementsPoolProxy);
-                }
-                else
-                {
-                    free(topStackElement);
-                }
-
+                recycleListElement(stackContainer, topStackElement);
                 topStackElement = NULL;
             }
         }
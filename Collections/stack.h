@@ -1,6 +1,7 @@
 #pragma once
 
 #include "codeutils.h"
+#include "listelementspoolproxy.h"
 
 typedef struct
 {
@@ -14,6 +15,7 @@ extern "C"
 #endif
 
     Stack* createStack(void* elementsPool);
+    Stack* createStackWithAllocator(const ListElementsAllocator* allocator, void* allocatorContext);
     void deleteStack(Stack* stack, void (*deallocObject)(Object* object));
 
     bool pushToStack(Stack* stack, const int objectType, void* const objectPayload);
@@ -0,0 +1,1143 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "bitoperations.h"
+#include "compactlist.h"
+#include "error.h"
+
+#ifdef UNIX_OS
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define DEFAULT_MAX_COMPACT_SLICES_COUNT 64
+#define MAX_COMPACT_SLICES_COUNT 0xFFFF // slice index 0xFFFF is reserved (COMPACT_NULL_ELEMENT_ID)
+#define SLICE_INDEX_OFFSET 16
+#define SLICE_ELEMENT_INDEX_MASK 0xFFFF
+#define SHARED_REGION_MAGIC 0x434C5350 // "CLSP"
+#define SNAPSHOT_MAGIC 0x434C534E      // "CLSN"
+#define REGION_HEADER_SIZE 4096        // the slices start at a page boundary
+#define SHARED_REGION_PERMISSIONS 0600
+
+// the columns share a single allocation (objects first, for alignment reasons)
+typedef struct
+{
+    CompactObject* objects;
+    CompactElementId* links;
+    CompactPriority* priorities;
+    void* data;
+} CompactSlice;
+
+typedef struct
+{
+    size_t slicesCount;
+    size_t maxSlicesCount;
+    size_t aquiredElementsCount;
+    CompactElementId firstAvailableElementId; // available elements are chained through the links column
+} CompactPoolState;
+
+typedef struct
+{
+    CompactElementId first;
+    CompactElementId last;
+    size_t size;
+} CompactListRoot;
+
+typedef struct
+{
+    CompactSlice* slices;    // process-local views of the slices
+    CompactPoolState* state; // points either to privateState or into the shared region
+    CompactPoolState privateState;
+    void* mappedRegion; // shared memory region or restored snapshot file, NULL for private pools
+    size_t mappedRegionSize;
+    size_t mappedSlicesCount; // the first slices reside within the mapped region, any further slices are heap allocated
+    bool isShared;
+    char* sharedRegionName; // only set for the region owner, which unlinks the region when deleting the pool
+} CompactElementsPoolContent;
+
+#ifdef UNIX_OS
+/* Beginning of a shared region or snapshot file, followed by the slices (in a shared region all of them are reserved
+   upfront, a snapshot only contains the created slices)
+   - the pool state only contains element IDs and counters so it is valid in any process the region is mapped into
+   - the mutex is process-shared and robust: if a process dies while holding it, the next locking process takes over
+   (not used by snapshots)
+*/
+typedef struct
+{
+    uint32_t magic; // written last by the creator, marks the region as initialized
+    uint32_t sliceElementsCount;
+    CompactPoolState state;
+    CompactListRoot publishedLists[COMPACT_SHARED_LISTS_COUNT];
+    pthread_mutex_t lock;
+} CompactRegionHeader;
+
+static_assert(sizeof(CompactRegionHeader) <= REGION_HEADER_SIZE, "The region header does not fit the reserved size!");
+#endif
+
+typedef struct
+{
+    CompactPriority priority;
+    uint32_t position; // original position within list, ensures sorting stability
+    CompactElementId elementId;
+} CompactSortingKey;
+
+// "private" (supporting) functions
+static CompactElementId aquireCompactElement(CompactElementsPool* elementsPool);
+static void releaseCompactElement(CompactElementsPool* elementsPool, CompactElementId elementId);
+static bool addCompactSlice(CompactElementsPoolContent* poolContent);
+static CompactElementsPoolContent* createCompactPoolContent(size_t maxSlicesCount);
+static void setSliceColumns(CompactSlice* slice, byte_t* sliceData);
+static size_t getCompactSliceDataSize();
+static bool writeSnapshotSlice(FILE* snapshotFile, const CompactSlice* slice);
+static bool lockSharedPool(CompactElementsPoolContent* poolContent);
+static void unlockSharedPool(CompactElementsPoolContent* poolContent);
+static bool retrieveSliceElement(const CompactList* list, CompactElementId elementId, CompactSlice** slice,
+                                 size_t* sliceElementIndex);
+static CompactElementId getElementId(size_t sliceIndex, size_t sliceElementIndex);
+static void initCompactElement(CompactSlice* slice, size_t sliceElementIndex);
+static int compareSortingKeys(const void* first, const void* second);
+#ifdef UNIX_OS
+static bool isSnapshotHeaderValid(const CompactRegionHeader* header, size_t fileSize);
+static bool isSnapshotElementIdValid(CompactElementId elementId, size_t slicesCount);
+#endif
+
+CompactElementsPool* createCompactElementsPool(size_t maxSlicesCount)
+{
+    CompactElementsPool* elementsPool = (CompactElementsPool*)malloc(sizeof(CompactElementsPool));
+    CompactElementsPoolContent* poolContent = elementsPool != NULL ? createCompactPoolContent(maxSlicesCount) : NULL;
+
+    if (poolContent != NULL)
+    {
+        elementsPool->poolContent = poolContent;
+    }
+    else
+    {
+        FREE(elementsPool);
+    }
+
+    return elementsPool;
+}
+
+CompactElementsPool* createSharedCompactElementsPool(const char* name, size_t maxSlicesCount)
+{
+    CompactElementsPool* elementsPool = NULL;
+
+#ifdef UNIX_OS
+    elementsPool = name != NULL ? (CompactElementsPool*)malloc(sizeof(CompactElementsPool)) : NULL;
+    CompactElementsPoolContent* poolContent = elementsPool != NULL ? createCompactPoolContent(maxSlicesCount) : NULL;
+    char* regionName = poolContent != NULL ? createStringCopy(name) : NULL;
+    const size_t slicesCount = poolContent != NULL ? poolContent->state->maxSlicesCount : 0;
+    const size_t regionSize = REGION_HEADER_SIZE + slicesCount * getCompactSliceDataSize();
+    const int fd = regionName != NULL ? shm_open(name, O_RDWR | O_CREAT | O_EXCL, SHARED_REGION_PERMISSIONS) : -1;
+    bool success = fd >= 0 && ftruncate(fd, (off_t)regionSize) == 0;
+    void* region = success ? mmap(NULL, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+    if (fd >= 0)
+    {
+        close(fd); // the mapping remains valid
+    }
+
+    success = region != MAP_FAILED;
+
+    if (success)
+    {
+        CompactRegionHeader* header = (CompactRegionHeader*)region;
+        pthread_mutexattr_t lockAttributes;
+
+        success = pthread_mutexattr_init(&lockAttributes) == 0;
+
+        if (success)
+        {
+            success = pthread_mutexattr_setpshared(&lockAttributes, PTHREAD_PROCESS_SHARED) == 0 &&
+                      pthread_mutexattr_setrobust(&lockAttributes, PTHREAD_MUTEX_ROBUST) == 0 &&
+                      pthread_mutex_init(&header->lock, &lockAttributes) == 0;
+            pthread_mutexattr_destroy(&lockAttributes);
+        }
+
+        if (success)
+        {
+            header->sliceElementsCount = COMPACT_POOL_SLICE_SIZE;
+            header->state = *poolContent->state;
+
+            for (size_t listSlot = 0; listSlot < COMPACT_SHARED_LISTS_COUNT; ++listSlot)
+            {
+                header->publishedLists[listSlot].first = COMPACT_NULL_ELEMENT_ID;
+                header->publishedLists[listSlot].last = COMPACT_NULL_ELEMENT_ID;
+                header->publishedLists[listSlot].size = 0;
+            }
+
+            for (size_t sliceIndex = 0; sliceIndex < header->state.maxSlicesCount; ++sliceIndex)
+            {
+                setSliceColumns(&poolContent->slices[sliceIndex], (byte_t*)region + REGION_HEADER_SIZE +
+                                                                      sliceIndex * getCompactSliceDataSize());
+            }
+
+            __atomic_store_n(&header->magic, SHARED_REGION_MAGIC, __ATOMIC_RELEASE);
+
+            poolContent->state = &header->state;
+            poolContent->mappedRegion = region;
+            poolContent->mappedRegionSize = regionSize;
+            poolContent->mappedSlicesCount = slicesCount;
+            poolContent->isShared = true;
+            poolContent->sharedRegionName = regionName;
+            elementsPool->poolContent = poolContent;
+        }
+        else
+        {
+            munmap(region, regionSize);
+        }
+    }
+
+    if (!success)
+    {
+        if (fd >= 0)
+        {
+            shm_unlink(name);
+        }
+
+        FREE(regionName);
+
+        if (poolContent != NULL)
+        {
+            FREE(poolContent->slices);
+            FREE(poolContent);
+        }
+
+        FREE(elementsPool);
+    }
+#else
+    (void)name;
+    (void)maxSlicesCount;
+#endif
+
+    return elementsPool;
+}
+
+CompactElementsPool* openSharedCompactElementsPool(const char* name)
+{
+    CompactElementsPool* elementsPool = NULL;
+
+#ifdef UNIX_OS
+    const int fd = name != NULL ? shm_open(name, O_RDWR, SHARED_REGION_PERMISSIONS) : -1;
+    struct stat regionStats;
+    const bool isRegionSizeValid =
+        fd >= 0 && fstat(fd, &regionStats) == 0 && (size_t)regionStats.st_size > REGION_HEADER_SIZE;
+    const size_t regionSize = isRegionSizeValid ? (size_t)regionStats.st_size : 0;
+    void* region = isRegionSizeValid ? mmap(NULL, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    CompactRegionHeader* header = region != MAP_FAILED ? (CompactRegionHeader*)region : NULL;
+    const bool isRegionValid =
+        header != NULL && __atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) == SHARED_REGION_MAGIC &&
+        header->sliceElementsCount == COMPACT_POOL_SLICE_SIZE &&
+        REGION_HEADER_SIZE + header->state.maxSlicesCount * getCompactSliceDataSize() == regionSize;
+
+    elementsPool = isRegionValid ? (CompactElementsPool*)malloc(sizeof(CompactElementsPool)) : NULL;
+    CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? createCompactPoolContent(header->state.maxSlicesCount) : NULL;
+
+    if (poolContent != NULL)
+    {
+        for (size_t sliceIndex = 0; sliceIndex < header->state.maxSlicesCount; ++sliceIndex)
+        {
+            setSliceColumns(&poolContent->slices[sliceIndex],
+                            (byte_t*)region + REGION_HEADER_SIZE + sliceIndex * getCompactSliceDataSize());
+        }
+
+        poolContent->state = &header->state;
+        poolContent->mappedRegion = region;
+        poolContent->mappedRegionSize = regionSize;
+        poolContent->mappedSlicesCount = header->state.maxSlicesCount;
+        poolContent->isShared = true;
+        elementsPool->poolContent = poolContent;
+    }
+    else
+    {
+        FREE(elementsPool);
+
+        if (region != MAP_FAILED)
+        {
+            munmap(region, regionSize);
+        }
+    }
+#else
+    (void)name;
+#endif
+
+    return elementsPool;
+}
+
+void deleteCompactElementsPool(CompactElementsPool* elementsPool)
+{
+    CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? (CompactElementsPoolContent*)elementsPool->poolContent : NULL;
+
+    ASSERT(elementsPool == NULL || poolContent != NULL, "Invalid compact elements pool content!");
+    ASSERT(poolContent == NULL || poolContent->isShared || poolContent->state->aquiredElementsCount == 0,
+           "Compact elements pool deleted while elements are still in use!");
+
+    if (poolContent != NULL)
+    {
+        // the slices from the mapped region have no heap data
+        for (size_t sliceIndex = 0; sliceIndex < poolContent->state->slicesCount; ++sliceIndex)
+        {
+            FREE(poolContent->slices[sliceIndex].data);
+        }
+    }
+
+    if (poolContent != NULL && poolContent->mappedRegion != NULL)
+    {
+#ifdef UNIX_OS
+        // the elements of a shared pool remain available to the other processes until they unmap the region too
+        munmap(poolContent->mappedRegion, poolContent->mappedRegionSize);
+
+        if (poolContent->sharedRegionName != NULL)
+        {
+            shm_unlink(poolContent->sharedRegionName);
+        }
+#endif
+        poolContent->mappedRegion = NULL;
+        FREE(poolContent->sharedRegionName);
+    }
+
+    if (poolContent != NULL)
+    {
+        FREE(poolContent->slices);
+        FREE(poolContent);
+        elementsPool->poolContent = NULL;
+    }
+
+    FREE(elementsPool);
+}
+
+/* The snapshot file contains the pool state, the root lists heads and the content of the created slices
+   - the objects are not persisted (only the priorities are), the restored elements have empty objects
+   - the lists should not be modified while the snapshot is being saved
+*/
+bool saveCompactElementsPoolSnapshot(CompactElementsPool* elementsPool, const CompactList* const* lists,
+                                     size_t listsCount, const char* filePath)
+{
+    bool success = false;
+
+#ifdef UNIX_OS
+    CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? (CompactElementsPoolContent*)elementsPool->poolContent : NULL;
+    bool areListsValid = (lists != NULL || listsCount == 0) && listsCount <= COMPACT_SHARED_LISTS_COUNT;
+
+    for (size_t listIndex = 0; areListsValid && listIndex < listsCount; ++listIndex)
+    {
+        areListsValid = lists[listIndex] == NULL || lists[listIndex]->elementsPool == elementsPool;
+    }
+
+    CompactRegionHeader* header = poolContent != NULL && areListsValid && filePath != NULL
+                                      ? (CompactRegionHeader*)calloc(1, REGION_HEADER_SIZE)
+                                      : NULL;
+    FILE* snapshotFile = header != NULL ? fopen(filePath, "wb") : NULL;
+
+    if (snapshotFile != NULL && lockSharedPool(poolContent))
+    {
+        header->magic = SNAPSHOT_MAGIC;
+        header->sliceElementsCount = COMPACT_POOL_SLICE_SIZE;
+        header->state = *poolContent->state;
+
+        for (size_t listSlot = 0; listSlot < COMPACT_SHARED_LISTS_COUNT; ++listSlot)
+        {
+            const CompactList* list = listSlot < listsCount ? lists[listSlot] : NULL;
+            header->publishedLists[listSlot].first = list != NULL ? list->first : COMPACT_NULL_ELEMENT_ID;
+            header->publishedLists[listSlot].last = list != NULL ? list->last : COMPACT_NULL_ELEMENT_ID;
+            header->publishedLists[listSlot].size = list != NULL ? list->size : 0;
+        }
+
+        success = fwrite(header, REGION_HEADER_SIZE, 1, snapshotFile) == 1;
+
+        for (size_t sliceIndex = 0; success && sliceIndex < header->state.slicesCount; ++sliceIndex)
+        {
+            success = writeSnapshotSlice(snapshotFile, &poolContent->slices[sliceIndex]);
+        }
+
+        unlockSharedPool(poolContent);
+    }
+
+    if (snapshotFile != NULL)
+    {
+        success = fclose(snapshotFile) == 0 && success;
+        snapshotFile = NULL;
+    }
+
+    FREE(header);
+#else
+    (void)elementsPool;
+    (void)lists;
+    (void)listsCount;
+    (void)filePath;
+#endif
+
+    return success;
+}
+
+/* The snapshot file is mapped privately (copy-on-write): the elements are linked by IDs so no fix-up is required and
+   the slices content is only read from file when accessed. Further slices (if required) are heap allocated. The root
+   lists are retrieved by calling attachPublishedCompactList() with the index of the list within the saved lists. */
+CompactElementsPool* loadCompactElementsPoolSnapshot(const char* filePath)
+{
+    CompactElementsPool* elementsPool = NULL;
+
+#ifdef UNIX_OS
+    const int fd = filePath != NULL ? open(filePath, O_RDONLY) : -1;
+    struct stat fileStats;
+    const bool isFileSizeValid =
+        fd >= 0 && fstat(fd, &fileStats) == 0 && (size_t)fileStats.st_size >= REGION_HEADER_SIZE;
+    const size_t fileSize = isFileSizeValid ? (size_t)fileStats.st_size : 0;
+    void* region = isFileSizeValid ? mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    CompactRegionHeader* header = region != MAP_FAILED ? (CompactRegionHeader*)region : NULL;
+    const bool isSnapshotValid = header != NULL && isSnapshotHeaderValid(header, fileSize);
+
+    elementsPool = isSnapshotValid ? (CompactElementsPool*)malloc(sizeof(CompactElementsPool)) : NULL;
+    CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? createCompactPoolContent(header->state.maxSlicesCount) : NULL;
+
+    if (poolContent != NULL)
+    {
+        for (size_t sliceIndex = 0; sliceIndex < header->state.slicesCount; ++sliceIndex)
+        {
+            setSliceColumns(&poolContent->slices[sliceIndex],
+                            (byte_t*)region + REGION_HEADER_SIZE + sliceIndex * getCompactSliceDataSize());
+        }
+
+        poolContent->state = &header->state;
+        poolContent->mappedRegion = region;
+        poolContent->mappedRegionSize = fileSize;
+        poolContent->mappedSlicesCount = header->state.slicesCount;
+        elementsPool->poolContent = poolContent;
+    }
+    else
+    {
+        FREE(elementsPool);
+
+        if (region != MAP_FAILED)
+        {
+            munmap(region, fileSize);
+        }
+    }
+#else
+    (void)filePath;
+#endif
+
+    return elementsPool;
+}
+
+size_t getCompactPoolAquiredElementsCount(const CompactElementsPool* elementsPool)
+{
+    const CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? (const CompactElementsPoolContent*)elementsPool->poolContent : NULL;
+
+    return poolContent != NULL ? poolContent->state->aquiredElementsCount : 0;
+}
+
+bool isSharedCompactElementsPool(const CompactElementsPool* elementsPool)
+{
+    const CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? (const CompactElementsPoolContent*)elementsPool->poolContent : NULL;
+
+    return poolContent != NULL && poolContent->isShared;
+}
+
+CompactList* createEmptyCompactList(CompactElementsPool* elementsPool)
+{
+    CompactList* list = NULL;
+
+    ASSERT(elementsPool != NULL, "A compact list requires a compact elements pool!");
+
+    if (elementsPool != NULL)
+    {
+        list = (CompactList*)malloc(sizeof(CompactList));
+    }
+
+    if (list != NULL)
+    {
+        list->first = COMPACT_NULL_ELEMENT_ID;
+        list->last = COMPACT_NULL_ELEMENT_ID;
+        list->size = 0;
+        list->elementsPool = elementsPool;
+    }
+
+    return list;
+}
+
+CompactList* createCompactListFromPrioritiesArray(const Priority* prioritiesArray, const size_t arraySize,
+                                                  CompactElementsPool* elementsPool)
+{
+    CompactList* list = NULL;
+
+    if (prioritiesArray != NULL && arraySize > 0)
+    {
+        list = createEmptyCompactList(elementsPool);
+        bool success = list != NULL;
+
+        for (size_t index = 0; success && index < arraySize; ++index)
+        {
+            success = createAndAppendToCompactList(list, prioritiesArray[index]) != COMPACT_NULL_ELEMENT_ID;
+        }
+
+        if (!success)
+        {
+            deleteCompactList(list, NULL);
+            list = NULL;
+        }
+    }
+
+    return list;
+}
+
+void deleteCompactList(CompactList* list, void (*deallocObject)(Object* object))
+{
+    clearCompactList(list, deallocObject);
+    FREE(list);
+}
+
+// deallocObject can be NULL if the elements have empty objects
+void clearCompactList(CompactList* list, void (*deallocObject)(Object* object))
+{
+    if (list != NULL)
+    {
+        while (list->size > 0)
+        {
+            Object removedObject = removeFirstCompactListElement(list);
+
+            if (removedObject.type >= 0)
+            {
+                ASSERT(deallocObject != NULL, "No deallocator provided for a non-empty object!");
+
+                if (deallocObject != NULL)
+                {
+                    deallocObject(&removedObject);
+                }
+            }
+        }
+    }
+}
+
+CompactElementId createAndAppendToCompactList(CompactList* list, Priority priority)
+{
+    const CompactElementId elementId =
+        list != NULL && priority <= UINT32_MAX ? aquireCompactElement(list->elementsPool) : COMPACT_NULL_ELEMENT_ID;
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    if (retrieveSliceElement(list, elementId, &slice, &sliceElementIndex))
+    {
+        slice->priorities[sliceElementIndex] = (CompactPriority)priority;
+
+        CompactSlice* lastElementSlice = NULL;
+        size_t lastSliceElementIndex = 0;
+
+        if (retrieveSliceElement(list, list->last, &lastElementSlice, &lastSliceElementIndex))
+        {
+            lastElementSlice->links[lastSliceElementIndex] = elementId;
+        }
+        else
+        {
+            list->first = elementId;
+        }
+
+        list->last = elementId;
+        ++list->size;
+    }
+
+    return elementId;
+}
+
+CompactElementId createAndPrependToCompactList(CompactList* list, Priority priority)
+{
+    const CompactElementId elementId =
+        list != NULL && priority <= UINT32_MAX ? aquireCompactElement(list->elementsPool) : COMPACT_NULL_ELEMENT_ID;
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    if (retrieveSliceElement(list, elementId, &slice, &sliceElementIndex))
+    {
+        slice->priorities[sliceElementIndex] = (CompactPriority)priority;
+        slice->links[sliceElementIndex] = list->first;
+
+        if (list->first == COMPACT_NULL_ELEMENT_ID)
+        {
+            list->last = elementId;
+        }
+
+        list->first = elementId;
+        ++list->size;
+    }
+
+    return elementId;
+}
+
+Object removeFirstCompactListElement(CompactList* list)
+{
+    Object result;
+    result.type = -1;
+    result.payload = NULL;
+
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    if (list != NULL && retrieveSliceElement(list, list->first, &slice, &sliceElementIndex))
+    {
+        const CompactElementId removedElementId = list->first;
+
+        list->first = slice->links[sliceElementIndex];
+
+        if (list->first == COMPACT_NULL_ELEMENT_ID)
+        {
+            list->last = COMPACT_NULL_ELEMENT_ID;
+        }
+
+        --list->size;
+
+        result.type = slice->objects[sliceElementIndex].type;
+        result.payload = slice->objects[sliceElementIndex].payload;
+
+        releaseCompactElement(list->elementsPool, removedElementId);
+    }
+
+    return result;
+}
+
+void assignObjectContentToCompactListElement(CompactList* list, CompactElementId elementId, const int objectType,
+                                             void* const objectPayload)
+{
+    CompactObject* object = getCompactListElementObject(list, elementId);
+
+    if (object != NULL)
+    {
+        ASSERT(objectPayload == NULL || objectType >= 0 && (objectType & INLINE_OBJECT_FLAG) == 0,
+               "Attempt to assign object that has a type inconsistent with the payload!")
+        ASSERT(object->payload == NULL, "Attempt to assign object without emptying the existing one first!");
+
+        object->type = objectType;
+        object->payload = objectPayload;
+    }
+}
+
+CompactObject* getCompactListElementObject(const CompactList* list, CompactElementId elementId)
+{
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    return retrieveSliceElement(list, elementId, &slice, &sliceElementIndex) ? &slice->objects[sliceElementIndex]
+                                                                              : NULL;
+}
+
+CompactPriority getCompactListElementPriority(const CompactList* list, CompactElementId elementId)
+{
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    return retrieveSliceElement(list, elementId, &slice, &sliceElementIndex) ? slice->priorities[sliceElementIndex]
+                                                                              : 0;
+}
+
+CompactElementId getNextCompactListElementId(const CompactList* list, CompactElementId elementId)
+{
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    return retrieveSliceElement(list, elementId, &slice, &sliceElementIndex) ? slice->links[sliceElementIndex]
+                                                                              : COMPACT_NULL_ELEMENT_ID;
+}
+
+size_t getCompactListSize(const CompactList* list)
+{
+    return list != NULL ? list->size : 0;
+}
+
+// the list elements should not be modified by other processes while the list is being published
+bool publishCompactList(const CompactList* list, size_t listSlot)
+{
+    bool success = false;
+    CompactElementsPoolContent* poolContent = list != NULL && list->elementsPool != NULL
+                                                  ? (CompactElementsPoolContent*)list->elementsPool->poolContent
+                                                  : NULL;
+
+#ifdef UNIX_OS
+    if (poolContent != NULL && poolContent->mappedRegion != NULL && listSlot < COMPACT_SHARED_LISTS_COUNT &&
+        lockSharedPool(poolContent))
+    {
+        CompactListRoot* listRoot = &((CompactRegionHeader*)poolContent->mappedRegion)->publishedLists[listSlot];
+        listRoot->first = list->first;
+        listRoot->last = list->last;
+        listRoot->size = list->size;
+
+        unlockSharedPool(poolContent);
+        success = true;
+    }
+#else
+    (void)poolContent;
+    (void)listSlot;
+#endif
+
+    return success;
+}
+
+CompactList* attachPublishedCompactList(CompactElementsPool* elementsPool, size_t listSlot)
+{
+    CompactList* list = NULL;
+    CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? (CompactElementsPoolContent*)elementsPool->poolContent : NULL;
+
+#ifdef UNIX_OS
+    if (poolContent != NULL && poolContent->mappedRegion != NULL && listSlot < COMPACT_SHARED_LISTS_COUNT)
+    {
+        list = createEmptyCompactList(elementsPool);
+    }
+
+    if (list != NULL && lockSharedPool(poolContent))
+    {
+        const CompactListRoot* listRoot =
+            &((const CompactRegionHeader*)poolContent->mappedRegion)->publishedLists[listSlot];
+        list->first = listRoot->first;
+        list->last = listRoot->last;
+        list->size = listRoot->size;
+
+        unlockSharedPool(poolContent);
+    }
+    else
+    {
+        FREE(list);
+    }
+#else
+    (void)poolContent;
+    (void)listSlot;
+#endif
+
+    return list;
+}
+
+void detachCompactList(CompactList* list)
+{
+    FREE(list);
+}
+
+bool isCompactListSortedAscendingByPriority(const CompactList* list)
+{
+    bool isSorted = true;
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+    bool hasPreviousPriority = false;
+    CompactPriority previousPriority = 0;
+
+    for (CompactElementId elementId = list != NULL ? list->first : COMPACT_NULL_ELEMENT_ID;
+         isSorted && retrieveSliceElement(list, elementId, &slice, &sliceElementIndex);
+         elementId = slice->links[sliceElementIndex])
+    {
+        const CompactPriority currentPriority = slice->priorities[sliceElementIndex];
+        isSorted = !hasPreviousPriority || previousPriority <= currentPriority;
+        previousPriority = currentPriority;
+        hasPreviousPriority = true;
+    }
+
+    return isSorted;
+}
+
+bool getCompactListPrioritiesRange(const CompactList* list, CompactPriority* minPriority, CompactPriority* maxPriority)
+{
+    bool success = false;
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+    CompactPriority currentMinPriority = UINT32_MAX;
+    CompactPriority currentMaxPriority = 0;
+
+    for (CompactElementId elementId = list != NULL ? list->first : COMPACT_NULL_ELEMENT_ID;
+         retrieveSliceElement(list, elementId, &slice, &sliceElementIndex); elementId = slice->links[sliceElementIndex])
+    {
+        const CompactPriority currentPriority = slice->priorities[sliceElementIndex];
+        currentMinPriority = currentPriority < currentMinPriority ? currentPriority : currentMinPriority;
+        currentMaxPriority = currentPriority > currentMaxPriority ? currentPriority : currentMaxPriority;
+        success = true;
+    }
+
+    if (success && minPriority != NULL && maxPriority != NULL)
+    {
+        *minPriority = currentMinPriority;
+        *maxPriority = currentMaxPriority;
+    }
+
+    return success && minPriority != NULL && maxPriority != NULL;
+}
+
+size_t copyCompactListPriorities(const CompactList* list, CompactPriority* priorities, size_t maxCount)
+{
+    size_t copiedPrioritiesCount = 0;
+    CompactSlice* slice = NULL;
+    size_t sliceElementIndex = 0;
+
+    for (CompactElementId elementId = list != NULL && priorities != NULL ? list->first : COMPACT_NULL_ELEMENT_ID;
+         copiedPrioritiesCount < maxCount && retrieveSliceElement(list, elementId, &slice, &sliceElementIndex);
+         elementId = slice->links[sliceElementIndex])
+    {
+        priorities[copiedPrioritiesCount] = slice->priorities[sliceElementIndex];
+        ++copiedPrioritiesCount;
+    }
+
+    return copiedPrioritiesCount;
+}
+
+/* The sorting keys (priority + element ID) are extracted from the priority column, sorted and then used for re-linking
+   the elements; the objects column is not accessed at all */
+bool sortCompactListAscendingByPriority(CompactList* list)
+{
+    bool success = false;
+    CompactSortingKey* sortingKeys =
+        list != NULL && list->size > 1 ? (CompactSortingKey*)malloc(list->size * sizeof(CompactSortingKey)) : NULL;
+
+    if (sortingKeys != NULL)
+    {
+        CompactSlice* slice = NULL;
+        size_t sliceElementIndex = 0;
+        size_t keysCount = 0;
+
+        for (CompactElementId elementId = list->first;
+             keysCount < list->size && retrieveSliceElement(list, elementId, &slice, &sliceElementIndex);
+             elementId = slice->links[sliceElementIndex])
+        {
+            sortingKeys[keysCount].priority = slice->priorities[sliceElementIndex];
+            sortingKeys[keysCount].position = (uint32_t)keysCount;
+            sortingKeys[keysCount].elementId = elementId;
+            ++keysCount;
+        }
+
+        ASSERT(keysCount == list->size, "Compact list size inconsistent with the number of linked elements!");
+
+        qsort(sortingKeys, keysCount, sizeof(CompactSortingKey), compareSortingKeys);
+
+        for (size_t keyIndex = 0; keyIndex < keysCount; ++keyIndex)
+        {
+            if (retrieveSliceElement(list, sortingKeys[keyIndex].elementId, &slice, &sliceElementIndex))
+            {
+                slice->links[sliceElementIndex] =
+                    keyIndex + 1 < keysCount ? sortingKeys[keyIndex + 1].elementId : COMPACT_NULL_ELEMENT_ID;
+            }
+        }
+
+        list->first = sortingKeys[0].elementId;
+        list->last = sortingKeys[keysCount - 1].elementId;
+
+        FREE(sortingKeys);
+        success = true;
+    }
+    else if (list != NULL && list->size <= 1)
+    {
+        success = true;
+    }
+
+    return success;
+}
+
+static CompactElementId aquireCompactElement(CompactElementsPool* elementsPool)
+{
+    CompactElementId elementId = COMPACT_NULL_ELEMENT_ID;
+    CompactElementsPoolContent* poolContent =
+        elementsPool != NULL ? (CompactElementsPoolContent*)elementsPool->poolContent : NULL;
+
+    ASSERT(elementsPool == NULL || poolContent != NULL, "Invalid compact elements pool content!");
+
+    const bool isLocked = poolContent != NULL && lockSharedPool(poolContent);
+    CompactPoolState* state = isLocked ? poolContent->state : NULL;
+
+    if (state != NULL && (state->firstAvailableElementId != COMPACT_NULL_ELEMENT_ID || addCompactSlice(poolContent)))
+    {
+        elementId = state->firstAvailableElementId;
+
+        CompactSlice* slice = &poolContent->slices[elementId >> SLICE_INDEX_OFFSET];
+        const size_t sliceElementIndex = elementId & SLICE_ELEMENT_INDEX_MASK;
+
+        state->firstAvailableElementId = slice->links[sliceElementIndex];
+        initCompactElement(slice, sliceElementIndex);
+
+        ++state->aquiredElementsCount;
+    }
+
+    if (isLocked)
+    {
+        unlockSharedPool(poolContent);
+    }
+
+    return elementId;
+}
+
+// it is assumed that a cleanup of the object data has been performed prior to releasing the element
+static void releaseCompactElement(CompactElementsPool* elementsPool, CompactElementId elementId)
+{
+    CompactElementsPoolContent* poolContent = (CompactElementsPoolContent*)elementsPool->poolContent;
+    const size_t sliceIndex = elementId >> SLICE_INDEX_OFFSET;
+
+    if (lockSharedPool(poolContent))
+    {
+        CompactPoolState* state = poolContent->state;
+
+        ASSERT(sliceIndex < state->slicesCount && state->aquiredElementsCount > 0, "Invalid compact element release!");
+
+        if (sliceIndex < state->slicesCount)
+        {
+            CompactSlice* slice = &poolContent->slices[sliceIndex];
+            const size_t sliceElementIndex = elementId & SLICE_ELEMENT_INDEX_MASK;
+
+            initCompactElement(slice, sliceElementIndex);
+            slice->links[sliceElementIndex] = state->firstAvailableElementId;
+            state->firstAvailableElementId = elementId;
+
+            --state->aquiredElementsCount;
+        }
+
+        unlockSharedPool(poolContent);
+    }
+}
+
+// the slices residing within the mapped region are reserved upfront, they only need to be initialized
+static bool addCompactSlice(CompactElementsPoolContent* poolContent)
+{
+    bool success = false;
+    CompactPoolState* state = poolContent->state;
+
+    if (state->slicesCount < state->maxSlicesCount)
+    {
+        const size_t sliceIndex = state->slicesCount;
+        CompactSlice* slice = &poolContent->slices[sliceIndex];
+        const bool isMappedSlice = sliceIndex < poolContent->mappedSlicesCount;
+        byte_t* data = !isMappedSlice ? (byte_t*)malloc(getCompactSliceDataSize()) : NULL;
+
+        if (data != NULL)
+        {
+            setSliceColumns(slice, data);
+            slice->data = data;
+        }
+
+        if (data != NULL || isMappedSlice)
+        {
+            // chain the new elements in ascending index order so consecutively aquired elements are adjacent
+            for (size_t sliceElementIndex = 0; sliceElementIndex < COMPACT_POOL_SLICE_SIZE; ++sliceElementIndex)
+            {
+                initCompactElement(slice, sliceElementIndex);
+                slice->links[sliceElementIndex] = sliceElementIndex + 1 < COMPACT_POOL_SLICE_SIZE
+                                                      ? getElementId(sliceIndex, sliceElementIndex + 1)
+                                                      : state->firstAvailableElementId;
+            }
+
+            state->firstAvailableElementId = getElementId(sliceIndex, 0);
+            ++state->slicesCount;
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+static CompactElementsPoolContent* createCompactPoolContent(size_t maxSlicesCount)
+{
+    CompactElementsPoolContent* poolContent = NULL;
+    const size_t actualMaxSlicesCount = maxSlicesCount > 0 ? maxSlicesCount : DEFAULT_MAX_COMPACT_SLICES_COUNT;
+
+    ASSERT(actualMaxSlicesCount <= MAX_COMPACT_SLICES_COUNT, "The maximum slices count is too large!");
+
+    if (actualMaxSlicesCount <= MAX_COMPACT_SLICES_COUNT)
+    {
+        poolContent = (CompactElementsPoolContent*)malloc(sizeof(CompactElementsPoolContent));
+    }
+
+    CompactSlice* slices =
+        poolContent != NULL ? (CompactSlice*)calloc(actualMaxSlicesCount, sizeof(CompactSlice)) : NULL;
+
+    if (slices != NULL)
+    {
+        poolContent->slices = slices;
+        poolContent->privateState.slicesCount = 0;
+        poolContent->privateState.maxSlicesCount = actualMaxSlicesCount;
+        poolContent->privateState.aquiredElementsCount = 0;
+        poolContent->privateState.firstAvailableElementId = COMPACT_NULL_ELEMENT_ID;
+        poolContent->state = &poolContent->privateState;
+        poolContent->mappedRegion = NULL;
+        poolContent->mappedRegionSize = 0;
+        poolContent->mappedSlicesCount = 0;
+        poolContent->isShared = false;
+        poolContent->sharedRegionName = NULL;
+    }
+    else
+    {
+        FREE(poolContent);
+    }
+
+    return poolContent;
+}
+
+static void setSliceColumns(CompactSlice* slice, byte_t* sliceData)
+{
+    slice->objects = (CompactObject*)sliceData;
+    slice->links = (CompactElementId*)(sliceData + COMPACT_POOL_SLICE_SIZE * sizeof(CompactObject));
+    slice->priorities =
+        (CompactPriority*)(sliceData + COMPACT_POOL_SLICE_SIZE * (sizeof(CompactObject) + sizeof(CompactElementId)));
+    slice->data = NULL;
+}
+
+static size_t getCompactSliceDataSize()
+{
+    return COMPACT_POOL_SLICE_SIZE * (sizeof(CompactObject) + sizeof(CompactElementId) + sizeof(CompactPriority));
+}
+
+/* The payloads are process-local pointers, so the objects are persisted as empty (a restored object type would refer
+   to a missing payload)
+*/
+static bool writeSnapshotSlice(FILE* snapshotFile, const CompactSlice* slice)
+{
+    bool success = false;
+    CompactObject* objects = (CompactObject*)malloc(COMPACT_POOL_SLICE_SIZE * sizeof(CompactObject));
+
+    if (objects != NULL)
+    {
+        for (size_t sliceElementIndex = 0; sliceElementIndex < COMPACT_POOL_SLICE_SIZE; ++sliceElementIndex)
+        {
+            objects[sliceElementIndex].payload = NULL;
+            objects[sliceElementIndex].type = -1;
+        }
+
+        success = fwrite(objects, sizeof(CompactObject), COMPACT_POOL_SLICE_SIZE, snapshotFile) ==
+                      COMPACT_POOL_SLICE_SIZE &&
+                  fwrite(slice->links, sizeof(CompactElementId), COMPACT_POOL_SLICE_SIZE, snapshotFile) ==
+                      COMPACT_POOL_SLICE_SIZE &&
+                  fwrite(slice->priorities, sizeof(CompactPriority), COMPACT_POOL_SLICE_SIZE, snapshotFile) ==
+                      COMPACT_POOL_SLICE_SIZE;
+
+        FREE(objects);
+    }
+
+    return success;
+}
+
+// no locking required for private pools
+static bool lockSharedPool(CompactElementsPoolContent* poolContent)
+{
+    bool success = true;
+
+#ifdef UNIX_OS
+    if (poolContent->isShared)
+    {
+        pthread_mutex_t* lock = &((CompactRegionHeader*)poolContent->mappedRegion)->lock;
+        int status = pthread_mutex_lock(lock);
+
+        // previous owner died while holding the lock: the pool state is only updated by a few stores, take it over
+        if (status == EOWNERDEAD)
+        {
+            status = pthread_mutex_consistent(lock);
+        }
+
+        success = status == 0;
+        ASSERT(success, "Unable to lock the shared compact elements pool!");
+    }
+#endif
+
+    return success;
+}
+
+static void unlockSharedPool(CompactElementsPoolContent* poolContent)
+{
+#ifdef UNIX_OS
+    if (poolContent->isShared)
+    {
+        pthread_mutex_unlock(&((CompactRegionHeader*)poolContent->mappedRegion)->lock);
+    }
+#else
+    (void)poolContent;
+#endif
+}
+
+static bool retrieveSliceElement(const CompactList* list, CompactElementId elementId, CompactSlice** slice,
+                                 size_t* sliceElementIndex)
+{
+    bool success = false;
+    const CompactElementsPoolContent* poolContent =
+        list != NULL && list->elementsPool != NULL ? (const CompactElementsPoolContent*)list->elementsPool->poolContent
+                                                   : NULL;
+    const size_t sliceIndex = elementId >> SLICE_INDEX_OFFSET;
+
+    if (poolContent != NULL && elementId != COMPACT_NULL_ELEMENT_ID && sliceIndex < poolContent->state->slicesCount)
+    {
+        *slice = &poolContent->slices[sliceIndex];
+        *sliceElementIndex = elementId & SLICE_ELEMENT_INDEX_MASK;
+        success = *sliceElementIndex < COMPACT_POOL_SLICE_SIZE;
+    }
+
+    return success;
+}
+
+static CompactElementId getElementId(size_t sliceIndex, size_t sliceElementIndex)
+{
+    return (CompactElementId)(sliceIndex << SLICE_INDEX_OFFSET | sliceElementIndex);
+}
+
+static void initCompactElement(CompactSlice* slice, size_t sliceElementIndex)
+{
+    slice->objects[sliceElementIndex].payload = NULL;
+    slice->objects[sliceElementIndex].type = -1;
+    slice->links[sliceElementIndex] = COMPACT_NULL_ELEMENT_ID;
+    slice->priorities[sliceElementIndex] = 0;
+}
+
+static int compareSortingKeys(const void* first, const void* second)
+{
+    const CompactSortingKey* firstKey = (const CompactSortingKey*)first;
+    const CompactSortingKey* secondKey = (const CompactSortingKey*)second;
+
+    int result = 0;
+
+    if (firstKey->priority != secondKey->priority)
+    {
+        result = firstKey->priority < secondKey->priority ? -1 : 1;
+    }
+    else if (firstKey->position != secondKey->position)
+    {
+        result = firstKey->position < secondKey->position ? -1 : 1;
+    }
+
+    return result;
+}
+
+#ifdef UNIX_OS
+// the snapshot file content is not trusted: any element ID it contains should point into the saved slices
+static bool isSnapshotHeaderValid(const CompactRegionHeader* header, size_t fileSize)
+{
+    const CompactPoolState* state = &header->state;
+    bool isValid = header->magic == SNAPSHOT_MAGIC && header->sliceElementsCount == COMPACT_POOL_SLICE_SIZE &&
+                   state->slicesCount <= state->maxSlicesCount && state->maxSlicesCount <= MAX_COMPACT_SLICES_COUNT &&
+                   REGION_HEADER_SIZE + state->slicesCount * getCompactSliceDataSize() == fileSize &&
+                   state->aquiredElementsCount <= state->slicesCount * COMPACT_POOL_SLICE_SIZE &&
+                   isSnapshotElementIdValid(state->firstAvailableElementId, state->slicesCount);
+
+    for (size_t listSlot = 0; isValid && listSlot < COMPACT_SHARED_LISTS_COUNT; ++listSlot)
+    {
+        const CompactListRoot* listRoot = &header->publishedLists[listSlot];
+        isValid = isSnapshotElementIdValid(listRoot->first, state->slicesCount) &&
+                  isSnapshotElementIdValid(listRoot->last, state->slicesCount) &&
+                  listRoot->size <= state->aquiredElementsCount;
+    }
+
+    return isValid;
+}
+
+static bool isSnapshotElementIdValid(CompactElementId elementId, size_t slicesCount)
+{
+    return elementId == COMPACT_NULL_ELEMENT_ID || ((elementId >> SLICE_INDEX_OFFSET) < slicesCount &&
+                                                    (elementId & SLICE_ELEMENT_INDEX_MASK) < COMPACT_POOL_SLICE_SIZE);
+}
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "listelement.h"
+
+#define COMPACT_POOL_SLICE_SIZE 1024
+#define COMPACT_NULL_ELEMENT_ID UINT32_MAX
+#define COMPACT_SHARED_LISTS_COUNT 8
+
+/* Compact lists are lists residing entirely within one compact elements pool, which allows replacing the element
+   pointers by 32-bit element IDs and the priorities by 32-bit values
+   - an element ID packs the slice index (upper 16 bits) and the index of the element within the slice (lower 16 bits)
+   - the slices use a structure of arrays layout: links, priorities and objects are stored in parallel arrays (columns),
+   so priority-centric passes (sorted check, min/max, priority extraction, sorting) only read the link and priority
+   columns (8 bytes per element instead of the 40 bytes of a regular list element)
+   - the elements are accessed by ID, the objects are restricted to type + payload pointer (no inline payloads)
+   - the pool slices are created on demand, up to a maximum slices count; there is no slice deletion until the pool gets
+   deleted (the elements remain at the same location for the whole pool lifetime)
+   - released elements are chained into a free list (through the links column) and re-used first
+*/
+
+/* Shared compact pools (UNIX only) place the pool state and all slices into a named shared memory region
+   - since the elements are linked by IDs (offsets within the region), a list built by one process can be traversed and
+   sorted in place by any other process that opened the pool, no copying required
+   - a list is handed over by publishing its head (first/last/size) into one of the COMPACT_SHARED_LISTS_COUNT slots of
+   the region; another process attaches to the slot and gets a list header referencing the same elements
+   - aquiring and releasing elements is protected by a robust process-shared mutex; modifying the same list from
+   multiple processes at the same time requires additional synchronization by the user
+   - the payloads are process-local pointers, only the priorities and object types are meaningful to other processes
+   - the creator owns the region name: deleting its pool unlinks the region (the memory remains valid for the processes
+   that still have it mapped)
+*/
+
+/* Snapshots (UNIX only) persist a compact pool together with its root lists into a file, using the same layout as the
+   shared region. Restoring maps the file without any per-element work (the ID links require no fix-up), so a fully
+   built dataset is brought back at I/O cost. The objects are not persisted: the restored elements have empty objects
+   (type -1, NULL payload).
+*/
+typedef uint32_t CompactElementId;
+typedef uint32_t CompactPriority;
+
+typedef struct
+{
+    void* payload;
+    int type;
+} CompactObject;
+
+typedef struct
+{
+    void* poolContent;
+} CompactElementsPool;
+
+typedef struct
+{
+    CompactElementId first;
+    CompactElementId last; // required for constant time element appending
+    size_t size;
+    CompactElementsPool* elementsPool;
+} CompactList;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    CompactElementsPool* createCompactElementsPool(size_t maxSlicesCount); // 0: default maximum slices count
+    void deleteCompactElementsPool(CompactElementsPool* elementsPool);
+    CompactElementsPool* createSharedCompactElementsPool(const char* name, size_t maxSlicesCount);
+    CompactElementsPool* openSharedCompactElementsPool(const char* name);
+    size_t getCompactPoolAquiredElementsCount(const CompactElementsPool* elementsPool);
+    bool isSharedCompactElementsPool(const CompactElementsPool* elementsPool);
+
+    // up to COMPACT_SHARED_LISTS_COUNT root lists can be saved together with the pool
+    bool saveCompactElementsPoolSnapshot(CompactElementsPool* elementsPool, const CompactList* const* lists,
+                                         size_t listsCount, const char* filePath);
+    CompactElementsPool* loadCompactElementsPoolSnapshot(const char* filePath);
+
+    CompactList* createEmptyCompactList(CompactElementsPool* elementsPool);
+    CompactList* createCompactListFromPrioritiesArray(const Priority* prioritiesArray, const size_t arraySize,
+                                                      CompactElementsPool* elementsPool);
+    void deleteCompactList(CompactList* list, void (*deallocObject)(Object* object));
+    void clearCompactList(CompactList* list, void (*deallocObject)(Object* object));
+
+    // priorities that don't fit into 32 bits are rejected (COMPACT_NULL_ELEMENT_ID returned)
+    CompactElementId createAndAppendToCompactList(CompactList* list, Priority priority);
+    CompactElementId createAndPrependToCompactList(CompactList* list, Priority priority);
+    Object removeFirstCompactListElement(CompactList* list); // element released, object content handed over to caller
+
+    void assignObjectContentToCompactListElement(CompactList* list, CompactElementId elementId, const int objectType,
+                                                 void* const objectPayload);
+    CompactObject* getCompactListElementObject(const CompactList* list, CompactElementId elementId);
+    CompactPriority getCompactListElementPriority(const CompactList* list, CompactElementId elementId);
+    CompactElementId getNextCompactListElementId(const CompactList* list, CompactElementId elementId);
+    size_t getCompactListSize(const CompactList* list);
+
+    /* Shared or snapshot restored compact pools only */
+
+    bool publishCompactList(const CompactList* list, size_t listSlot);
+    CompactList* attachPublishedCompactList(CompactElementsPool* elementsPool, size_t listSlot);
+    void detachCompactList(CompactList* list); // deletes the list header only, the elements are not released
+
+    /* Priority-centric functions (only the link and priority columns are accessed) */
+
+    bool isCompactListSortedAscendingByPriority(const CompactList* list);
+    bool getCompactListPrioritiesRange(const CompactList* list, CompactPriority* minPriority,
+                                       CompactPriority* maxPriority); // false for empty list
+    size_t copyCompactListPriorities(const CompactList* list, CompactPriority* priorities, size_t maxCount);
+    bool sortCompactListAscendingByPriority(CompactList* list); // stable, re-links the elements (objects not moved)
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,5 @@
 #include <errno.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -6,77 +7,77 @@
 #include "listsortutils.h"
 #include "testobjects.h"
 
+#define RELEASE_BATCH_SIZE 64 // max number of elements returned to pool in one go when clearing a list
+
 /* This function is for private use only; it erases the list elements without deallocating the payload of the Object
    Should be used with caution (might cause memory leaks) and only when sure that references to each Object data (type +
    payload) are contained within another list
 */
 static void clearListWithoutObjectsDeallocation(List* list);
 
+static void drainRecycleCache(List* list, size_t remainingElementsCount);
+
+// used for ordering list elements by their memory address
+static int compareListElementAddresses(const void* first, const void* second);
+
 List* createEmptyList(void* elementsPool)
+{
+    return createEmptyListWithAllocator(elementsPool != NULL ? getPoolElementsAllocator() : NULL, elementsPool);
+}
+
+List* createEmptyListWithAllocator(const ListElementsAllocator* allocator, void* allocatorContext)
 {
     List* list = (List*)malloc(sizeof(List));
 
     if (list != NULL)
     {
-        initEmptyList(list, elementsPool);
+        initEmptyListWithAllocator(list, allocator, allocatorContext);
     }
 
     return list;
 }
 
 List* createListFromPrioritiesArray(const Priority* prioritiesArray, const size_t arraySize, void* elementsPool)
+{
+    return createListFromPrioritiesArrayWithAllocator(
+        prioritiesArray, arraySize, elementsPool != NULL ? getPoolElementsAllocator() : NULL, elementsPool);
+}
+
+List* createListFromPrioritiesArrayWithAllocator(const Priority* prioritiesArray, const size_t arraySize,
+                                                 const ListElementsAllocator* allocator, void* allocatorContext)
 {
     List* list = NULL;
 
     if (prioritiesArray != NULL && arraySize > 0)
     {
-        list = createEmptyList(elementsPool);
+        list = createEmptyListWithAllocator(allocator, allocatorContext);
     }
 
     if (list != NULL)
     {
         bool success = false;
+        ListElement** elementsToAquire = (ListElement**)malloc(arraySize * sizeof(ListElement*));
 
-        if (elementsPool != NULL)
+        if (elementsToAquire != NULL)
         {
-            ListElement** elementsToAquire = (ListElement**)malloc(arraySize * sizeof(ListElement*));
+            success = aquireListElements(&list->elementsPoolProxy, elementsToAquire, arraySize);
+            const size_t elementsCountToAppend = success ? arraySize : 0;
 
-            if (elementsToAquire != NULL)
+            for (size_t index = 0; index < elementsCountToAppend; ++index)
             {
-                success = aquireListElements(&list->elementsPoolProxy, elementsToAquire, arraySize);
-                const size_t elementsCountToAppend = success ? arraySize : 0;
+                ListElement* element = elementsToAquire[index];
+                ASSERT(element != NULL, "NULL element aquired from elements pool!");
 
-                for (size_t index = 0; index < elementsCountToAppend; ++index)
+                if (element != NULL)
                 {
-                    ListElement* element = elementsToAquire[index];
-                    ASSERT(element != NULL, "NULL element aquired from elements pool!");
-
-                    if (element != NULL)
-                    {
-                        initListElement(element);
-                        element->priority = prioritiesArray[index];
-                        appendToList(list, element);
-                    }
+                    initListElement(element);
+                    element->priority = prioritiesArray[index];
+                    appendToList(list, element);
                 }
-
-                free(elementsToAquire); // no longer needed, elements got appended to list
-                elementsToAquire = NULL;
             }
-        }
-        else
-        {
-            success = true;
 
-            for (size_t index = 0; index < arraySize; ++index)
-            {
-                ListElement* listElement = createAndAppendToList(list, prioritiesArray[index]);
-
-                if (!listElement)
-                {
-                    success = false;
-                    break;
-                }
-            }
+            free(elementsToAquire); // no longer needed, elements got appended to list
+            elementsToAquire = NULL;
         }
 
         if (!success)
@@ -90,12 +91,21 @@ List* createListFromPrioritiesArray(const Priority* prioritiesArray, const size_
 }
 
 void initEmptyList(List* list, void* elementsPool)
+{
+    initEmptyListWithAllocator(list, elementsPool != NULL ? getPoolElementsAllocator() : NULL, elementsPool);
+}
+
+// a NULL allocator means the list elements are allocated on the heap
+void initEmptyListWithAllocator(List* list, const ListElementsAllocator* allocator, void* allocatorContext)
 {
     if (list != NULL)
     {
         list->first = NULL;
         list->last = NULL;
-        list->elementsPoolProxy.elementsPool = elementsPool;
+        initListElementsPoolProxy(&list->elementsPoolProxy, allocator, allocatorContext);
+        list->recycledElements = NULL;
+        list->recycledElementsCount = 0;
+        list->recycleCacheCapacity = 0;
     }
 }
 
@@ -109,6 +119,7 @@ void deleteList(List* list, void (*deallocObject)(Object* object))
             clearList(list, deallocObject);
         }
 
+        drainRecycleCache(list, 0);
         free(list);
     }
 }
@@ -122,29 +133,27 @@ void clearList(List* list, void (*deallocObject)(Object* object))
         list->first = NULL;
         list->last = NULL;
 
-        if (list->elementsPoolProxy.elementsPool != NULL)
-        {
-            while (currentElement != NULL)
-            {
-                deallocObject(&currentElement->object);
-                ListElement* elementToDelete = currentElement;
-                currentElement = currentElement->next;
-                const bool released = releaseListElement(elementToDelete, &list->elementsPoolProxy);
-                ASSERT(released, "Element not contained in elementsPool!");
-                elementToDelete = NULL;
-            }
-        }
-        else
+        // elements are returned to their allocator in batches, each batch is released while still "hot" in cache
+        while (currentElement != NULL)
         {
-            while (currentElement != NULL)
+            ListElement* firstBatchElement = currentElement;
+            ListElement* lastBatchElement = NULL;
+            size_t batchElementsCount = 0;
+
+            while (currentElement != NULL && batchElementsCount < RELEASE_BATCH_SIZE)
             {
                 deallocObject(&currentElement->object);
-                ListElement* elementToDelete = currentElement;
+                lastBatchElement = currentElement;
                 currentElement = currentElement->next;
-                free(elementToDelete);
-                elementToDelete = NULL;
+                ++batchElementsCount;
             }
+
+            const bool released = releaseListElements(&list->elementsPoolProxy, firstBatchElement, lastBatchElement,
+                                                      batchElementsCount);
+            ASSERT(released, "Elements could not be released!");
         }
+
+        drainRecycleCache(list, 0);
     }
 }
 
@@ -154,8 +163,7 @@ ListElement* createAndPrependToList(List* list, Priority priority)
 
     if (list != NULL)
     {
-        element = list->elementsPoolProxy.elementsPool != NULL ? aquireListElement(&list->elementsPoolProxy)
-                                                               : (ListElement*)malloc(sizeof(ListElement));
+        element = aquireListElementForList(list);
 
         if (element != NULL)
         {
@@ -179,8 +187,7 @@ ListElement* createAndAppendToList(List* list, Priority priority)
 
     if (list != NULL)
     {
-        element = list->elementsPoolProxy.elementsPool != NULL ? aquireListElement(&list->elementsPoolProxy)
-                                                               : (ListElement*)malloc(sizeof(ListElement));
+        element = aquireListElementForList(list);
 
         if (element != NULL)
         {
@@ -205,9 +212,7 @@ ListElement* createAndInsertBefore(ListIterator it, Priority priority)
 
     if (it.list != NULL)
     {
-        ListElement* const previousElement = it.list->elementsPoolProxy.elementsPool != NULL
-                                                 ? aquireListElement(&it.list->elementsPoolProxy)
-                                                 : createListElement();
+        ListElement* const previousElement = aquireListElementForList(it.list);
 
         if (previousElement != NULL)
         {
@@ -227,9 +232,7 @@ ListElement* createAndInsertAfter(ListIterator it, Priority priority)
 
     if (it.list != NULL)
     {
-        ListElement* const nextElement = it.list->elementsPoolProxy.elementsPool != NULL
-                                             ? aquireListElement(&it.list->elementsPoolProxy)
-                                             : createListElement();
+        ListElement* const nextElement = aquireListElementForList(it.list);
 
         if (nextElement != NULL)
         {
@@ -251,7 +254,8 @@ void moveContentToList(List* source, List* destination)
         if (destination->last != NULL)
         {
             ASSERT(destination->first != NULL, "Null pointer detected for first destination list element");
-            List* temp = createEmptyList(destination->elementsPoolProxy.elementsPool);
+            List* temp = createEmptyListWithAllocator(destination->elementsPoolProxy.allocator,
+                                                  destination->elementsPoolProxy.context);
             bool unsuccessfulElementAllocationOccurred = false;
 
             if (temp != NULL)
@@ -262,8 +266,7 @@ void moveContentToList(List* source, List* destination)
                 {
                     ListElement* elementToAppend = createAndAppendToList(temp, currentSourceElement->priority);
                     unsuccessfulElementAllocationOccurred = elementToAppend == NULL;
-                    elementToAppend->object.type = currentSourceElement->object.type;
-                    elementToAppend->object.payload = currentSourceElement->object.payload;
+                    elementToAppend->object = currentSourceElement->object;
                     currentSourceElement = currentSourceElement->next;
                 }
             }
@@ -291,8 +294,9 @@ void moveContentToList(List* source, List* destination)
         }
         else
         {
+            drainRecycleCache(destination, 0); // cached elements belong to the allocator to be replaced
             destination->first = source->first;
-            destination->elementsPoolProxy.elementsPool = source->elementsPoolProxy.elementsPool;
+            destination->elementsPoolProxy = source->elementsPoolProxy;
             destination->last = source->last;
             source->first = NULL;
             source->last = NULL;
@@ -316,7 +320,8 @@ ListElement* copyContentToList(const List* source, List* destination,
     {
         ASSERT(source->last != NULL, "Null pointer detected for last source list element");
 
-        List* temp = createEmptyList(destination->elementsPoolProxy.elementsPool);
+        List* temp = createEmptyListWithAllocator(destination->elementsPoolProxy.allocator,
+                                                  destination->elementsPoolProxy.context);
 
         if (temp != NULL)
         {
@@ -854,6 +859,51 @@ bool sortByPriorityUsingRandomAccess(List* list, void (*sortingAlgorithm)(ListEl
     return result;
 }
 
+/* The element contents (priority + object) are re-distributed among the existing elements so the list ends up being
+   traversed in ascending address order, then the elements are relinked accordingly
+   - no element gets aquired or released, so the function works for both pool-based and heap-allocated lists
+   - for pool-based lists, the elements can first be gathered into fewer slices by compacting the pool
+*/
+bool relayoutList(List* list)
+{
+    bool result = false;
+
+    if (list != NULL && list->first != NULL)
+    {
+        size_t arraySize = 0;
+        ListElement** array = moveListToArray(list, &arraySize);
+        ListElement* contents = array != NULL ? (ListElement*)malloc(arraySize * sizeof(ListElement)) : NULL;
+
+        if (contents != NULL)
+        {
+            for (size_t index = 0; index < arraySize; ++index)
+            {
+                contents[index] = *array[index];
+            }
+
+            qsort(array, arraySize, sizeof(ListElement*), compareListElementAddresses);
+
+            for (size_t index = 0; index < arraySize; ++index)
+            {
+                *array[index] = contents[index];
+            }
+
+            result = true;
+        }
+
+        // in case of allocation failure the list gets restored in its initial state
+        moveArrayToList(array, arraySize, list);
+
+        free(contents);
+        contents = NULL;
+
+        free(array);
+        array = NULL;
+    }
+
+    return result;
+}
+
 size_t getListSize(const List* list)
 {
     size_t length = 0;
@@ -1090,7 +1140,7 @@ void printListContentToFile(const List* list, const char* outFile, const char* h
                 {
                     fputs("no\t", outputFile);
                     fputs("Object type: ", outputFile);
-                    fputs(getTestObjectTypeAsString(currentElement->object.type), outputFile);
+                    fputs(getTestObjectTypeAsString(getObjectType(&currentElement->object)), outputFile);
                 }
                 else
                 {
@@ -1116,6 +1166,69 @@ void printListContentToFile(const List* list, const char* outFile, const char* h
     }
 }
 
+void setListRecycleCacheCapacity(List* list, size_t capacity)
+{
+    if (list != NULL)
+    {
+        list->recycleCacheCapacity =
+            capacity < LIST_MAX_RECYCLE_CACHE_CAPACITY ? capacity : LIST_MAX_RECYCLE_CACHE_CAPACITY;
+        drainRecycleCache(list, list->recycleCacheCapacity);
+    }
+}
+
+bool recycleListElement(List* list, ListElement* element)
+{
+    bool success = false;
+
+    if (list != NULL && element != NULL)
+    {
+        ASSERT(isEmptyObject(&element->object), "Attempt to recycle element without emptying its object first!");
+
+        if (list->recycledElementsCount < list->recycleCacheCapacity)
+        {
+            element->next = list->recycledElements;
+            list->recycledElements = element;
+            ++list->recycledElementsCount;
+            success = true;
+        }
+        else
+        {
+            success = releaseListElement(element, &list->elementsPoolProxy);
+        }
+    }
+
+    return success;
+}
+
+size_t getListRecycledElementsCount(const List* list)
+{
+    return list != NULL ? list->recycledElementsCount : 0;
+}
+
+// recycle cache first, then allocator
+ListElement* aquireListElementForList(List* list)
+{
+    ListElement* element = NULL;
+
+    if (list == NULL)
+    {
+        ASSERT(false, "Null list detected");
+    }
+    else if (list->recycledElements != NULL)
+    {
+        element = list->recycledElements;
+        list->recycledElements = element->next;
+        --list->recycledElementsCount;
+        initListElement(element);
+    }
+    else
+    {
+        element = aquireListElement(&list->elementsPoolProxy);
+    }
+
+    return element;
+}
+
 // not to be used for heap created lists unless the references to first and last have been previously stored (memory
 // leaks might occur)
 void detachListElements(List* list)
@@ -1134,23 +1247,54 @@ static void clearListWithoutObjectsDeallocation(List* list)
 
         while (currentElementToDelete != NULL)
         {
-            ListElement* elementToDelete = currentElementToDelete;
-            currentElementToDelete = currentElementToDelete->next;
-            elementToDelete->next = NULL;
+            ListElement* firstBatchElement = currentElementToDelete;
+            ListElement* lastBatchElement = NULL;
+            size_t batchElementsCount = 0;
 
-            if (list->elementsPoolProxy.elementsPool != NULL)
-            {
-                releaseListElement(elementToDelete, &list->elementsPoolProxy);
-            }
-            else
+            while (currentElementToDelete != NULL && batchElementsCount < RELEASE_BATCH_SIZE)
             {
-                free(elementToDelete);
+                lastBatchElement = currentElementToDelete;
+                currentElementToDelete = currentElementToDelete->next;
+                ++batchElementsCount;
             }
 
-            elementToDelete = NULL;
+            // the Object data of the elements is not deallocated (references kept by another list)
+            releaseListElements(&list->elementsPoolProxy, firstBatchElement, lastBatchElement, batchElementsCount);
         }
 
         list->first = NULL;
         list->last = NULL;
     }
 }
+
+// releases the cached elements that exceed the remaining count in one go
+static void drainRecycleCache(List* list, size_t remainingElementsCount)
+{
+    if (list->recycledElementsCount > remainingElementsCount)
+    {
+        const size_t elementsCountToRelease = list->recycledElementsCount - remainingElementsCount;
+        ListElement* firstElementToRelease = list->recycledElements;
+        ListElement* lastElementToRelease = firstElementToRelease;
+
+        for (size_t index = 1; index < elementsCountToRelease; ++index)
+        {
+            lastElementToRelease = lastElementToRelease->next;
+        }
+
+        list->recycledElements = lastElementToRelease->next;
+        list->recycledElementsCount = remainingElementsCount;
+        lastElementToRelease->next = NULL;
+
+        const bool released = releaseListElements(&list->elementsPoolProxy, firstElementToRelease, lastElementToRelease,
+                                                  elementsCountToRelease);
+        ASSERT(released, "Recycled elements could not be released!");
+    }
+}
+
+static int compareListElementAddresses(const void* first, const void* second)
+{
+    const uintptr_t firstAddress = (uintptr_t)(*(ListElement* const*)first);
+    const uintptr_t secondAddress = (uintptr_t)(*(ListElement* const*)second);
+
+    return firstAddress < secondAddress ? -1 : (firstAddress > secondAddress ? 1 : 0);
+}
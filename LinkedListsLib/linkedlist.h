@@ -4,11 +4,25 @@
 
 #include "listelementspoolproxy.h"
 
+#define LIST_MAX_RECYCLE_CACHE_CAPACITY 64
+
+/* The recycle cache (disabled by default) keeps a small number of released elements for re-use by the same list
+   - elements get into the cache by calling recycleListElement() instead of releaseListElement() after removing them
+   from the list; if the cache is full they are released to the allocator
+   - newly created list elements (including the ones aquired by aquireListElementForList()) are taken from the cache
+   first, which avoids the allocator round trip for high churn (e.g. queue-like) usage and re-uses elements that are
+   likely still in the CPU cache
+   - the cache gets drained (elements returned to allocator) when clearing/deleting the list or when reducing its
+   capacity
+*/
 typedef struct
 {
     ListElement* first;
     ListElement* last; // required for constant time element appending
     ListElementsPoolProxy elementsPoolProxy;
+    ListElement* recycledElements; // chained through their next pointers
+    size_t recycledElementsCount;
+    size_t recycleCacheCapacity;
 } List;
 
 typedef struct
@@ -24,11 +38,15 @@ extern "C"
 
     /* These functions should only be used for heap-based lists/elements */
 
-    List* createEmptyList(void* elementsPool);
+    List* createEmptyList(void* elementsPool); // elements pool or NULL (heap allocated elements)
+    List* createEmptyListWithAllocator(const ListElementsAllocator* allocator, void* allocatorContext);
 
     List* createListFromPrioritiesArray(const Priority* prioritiesArray, const size_t arraySize, void* elementsPool);
+    List* createListFromPrioritiesArrayWithAllocator(const Priority* prioritiesArray, const size_t arraySize,
+                                                     const ListElementsAllocator* allocator, void* allocatorContext);
 
     void initEmptyList(List* list, void* elementsPool);
+    void initEmptyListWithAllocator(List* list, const ListElementsAllocator* allocator, void* allocatorContext);
 
     void deleteList(List* list, void (*deallocObject)(Object* object));
     void clearList(List* list, void (*deallocObject)(Object* object));
@@ -47,6 +65,11 @@ extern "C"
     ListElement** moveListToArray(List* list, size_t* arraySize);
     void moveArrayToList(ListElement** array, const size_t arraySize, List* list);
 
+    void setListRecycleCacheCapacity(List* list, size_t capacity); // capped to LIST_MAX_RECYCLE_CACHE_CAPACITY
+    bool recycleListElement(List* list, ListElement* element); // element removed from list with emptied object
+    size_t getListRecycledElementsCount(const List* list);
+    ListElement* aquireListElementForList(List* list); // unlinked element, to be added to the list by the caller
+
     /* These functions can also be used for stack-based lists/elements too */
 
     void prependToList(List* list, ListElement* newElement);
@@ -73,6 +96,10 @@ extern "C"
     bool sortByPriorityUsingRandomAccess(List* list,
                                          void (*sortingAlgorithm)(ListElement** array, const size_t arraySize));
 
+    /* Places the list elements in ascending address order while preserving the content order (e.g. after sorting), for
+       faster sequential traversal. Pointers to the list elements (including iterators) are invalidated. */
+    bool relayoutList(List* list);
+
     size_t getListSize(const List* list);
     bool isEmptyList(const List* list);
 
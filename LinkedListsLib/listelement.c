@@ -42,6 +42,22 @@ void assignObjectContentToListElement(ListElement* element, const int objectType
     }
 }
 
+bool assignInlineObjectContentToListElement(ListElement* element, const int objectType, const void* payloadData,
+                                            size_t payloadSize)
+{
+    bool success = false;
+
+    if (element != NULL)
+    {
+        ASSERT(element->object.type < 0 && element->object.payload == NULL,
+               "Attempt to assign object without emptying the existing one first!");
+
+        success = setInlineObjectPayload(&element->object, objectType, payloadData, payloadSize);
+    }
+
+    return success;
+}
+
 Object detachContentFromListElement(ListElement* element)
 {
     Object result;
@@ -50,8 +66,7 @@ Object detachContentFromListElement(ListElement* element)
 
     if (element != NULL)
     {
-        result.type = element->object.type;
-        result.payload = element->object.payload;
+        result = element->object; // inline payload included
         element->object.type = -1;
         element->object.payload = NULL;
     }
@@ -64,6 +79,12 @@ void deleteObjectPayload(Object* object)
 {
     if (object != NULL)
     {
+        // an inline payload is part of the object, nothing to free
+        if (isInlineObject(object))
+        {
+            object->payload = NULL;
+        }
+
         FREE(object->payload);
         object->type = -1;
     }
@@ -71,9 +92,9 @@ void deleteObjectPayload(Object* object)
 
 /* This function is just added for having a default value to be passed to the copyContentToList() function as deep
    copying function pointer. User is responsible to pass a custom deep copying function with this signature if any list
-   element contains an non-empty Object.
+   element contains an non-empty Object which is not inline (inline objects are simply copied as they own no memory).
 
-   ---> To be used for lists with EMPTY objects only!
+   ---> To be used for lists with EMPTY or INLINE objects only!
 */
 bool copyObjectPlaceholder(const ListElement* source, ListElement* destination)
 {
@@ -81,9 +102,15 @@ bool copyObjectPlaceholder(const ListElement* source, ListElement* destination)
 
     if (source != NULL && destination != NULL)
     {
-        ASSERT(source->object.type < 0 && source->object.payload == NULL && destination->object.type < 0 &&
-                   destination->object.payload == NULL,
+        ASSERT((source->object.type < 0 && source->object.payload == NULL || isInlineObject(&source->object)) &&
+                   destination->object.type < 0 && destination->object.payload == NULL,
                "The source and/or destination element object is either invalid or non-empty");
+
+        if (isInlineObject(&source->object))
+        {
+            destination->object = source->object;
+        }
+
         success = true;
     }
 
@@ -100,8 +127,14 @@ bool customCopyObject(const ListElement* source, ListElement* destination)
     ASSERT(source->object.type >= 0, "Invalid source object type!");
 
     /* copy a NON-EMPTY source object to EMPTY destination object to avoid any memory leaks */
-    if (source != NULL && destination != NULL && source->object.type >= 0 && source->object.payload != NULL &&
+    if (source != NULL && destination != NULL && isInlineObject(&source->object) && destination->object.type < 0 &&
         destination->object.payload == NULL)
+    {
+        destination->object = source->object;
+        success = true;
+    }
+    else if (source != NULL && destination != NULL && source->object.type >= 0 && source->object.payload != NULL &&
+             destination->object.payload == NULL)
     {
         void* destinationObjectPayload = NULL;
 
@@ -24,14 +24,16 @@ extern "C"
     void initListElement(ListElement* element);
 
     void assignObjectContentToListElement(ListElement* element, const int objectType, void* const objectPayload);
+    bool assignInlineObjectContentToListElement(ListElement* element, const int objectType, const void* payloadData,
+                                                size_t payloadSize); // payload copied into element (no allocation)
     Object detachContentFromListElement(ListElement* element);
 
     /* don't use these two for stack created lists (heap-only) */
     void deleteObjectPayload(Object* object); // default object deallocator, only works for simple objects without
                                               // associated payload heap memory (e.g. Point, primitive types payloads)
     bool copyObjectPlaceholder(const ListElement* source,
-                               ListElement* destination); // default object copy function, does nothing but is required
-                                                          // for passing a default function pointer
+                               ListElement* destination); // default object copy function, only copies inline objects
+                                                          // but is required for passing a default function pointer
 
     // for testing purposes only
     bool customCopyObject(const ListElement* source, ListElement* destination);
@@ -0,0 +1,189 @@
+#include <stdio.h>
+
+#include "error.h"
+#include "listelementsarena.h"
+
+typedef struct ArenaBlock
+{
+    struct ArenaBlock* next;
+    size_t usedElementsCount;
+    ListElement elements[];
+} ArenaBlock;
+
+typedef struct
+{
+    ArenaBlock* firstBlock;
+    ArenaBlock* currentBlock; // the block elements are currently aquired from (always the last one)
+    size_t blockSize;
+    size_t aquiredElementsCount;
+} ListElementsArenaContent;
+
+// "private" (supporting) functions
+static ListElement* aquireArenaElement(void* context);
+static bool aquireArenaElements(void* context, ListElement** elements, size_t requiredElementsCount);
+static bool releaseArenaElement(void* context, ListElement* element);
+static bool releaseArenaElements(void* context, ListElement* first, ListElement* last, size_t elementsCount);
+static ArenaBlock* createArenaBlock(size_t blockSize);
+static void deleteArenaBlocks(ArenaBlock* firstBlock);
+
+static const ListElementsAllocator arenaElementsAllocator = {aquireArenaElement, aquireArenaElements,
+                                                             releaseArenaElement, releaseArenaElements};
+
+ListElementsArena* createListElementsArena(size_t blockSize)
+{
+    ListElementsArena* elementsArena = (ListElementsArena*)malloc(sizeof(ListElementsArena));
+    ListElementsArenaContent* arenaContent =
+        elementsArena != NULL ? (ListElementsArenaContent*)malloc(sizeof(ListElementsArenaContent)) : NULL;
+    const size_t actualBlockSize = blockSize > 0 ? blockSize : ARENA_DEFAULT_BLOCK_SIZE;
+    ArenaBlock* firstBlock = arenaContent != NULL ? createArenaBlock(actualBlockSize) : NULL;
+
+    if (firstBlock != NULL)
+    {
+        arenaContent->firstBlock = firstBlock;
+        arenaContent->currentBlock = firstBlock;
+        arenaContent->blockSize = actualBlockSize;
+        arenaContent->aquiredElementsCount = 0;
+        elementsArena->arenaContent = arenaContent;
+    }
+    else
+    {
+        FREE(arenaContent);
+        FREE(elementsArena);
+    }
+
+    return elementsArena;
+}
+
+void deleteListElementsArena(ListElementsArena* elementsArena)
+{
+    ListElementsArenaContent* arenaContent =
+        elementsArena != NULL ? (ListElementsArenaContent*)elementsArena->arenaContent : NULL;
+
+    ASSERT(elementsArena == NULL || arenaContent != NULL, "Invalid arena content!");
+
+    if (arenaContent != NULL)
+    {
+        deleteArenaBlocks(arenaContent->firstBlock);
+        arenaContent->firstBlock = NULL;
+        arenaContent->currentBlock = NULL;
+    }
+
+    FREE(arenaContent);
+    FREE(elementsArena);
+}
+
+void resetListElementsArena(ListElementsArena* elementsArena)
+{
+    ListElementsArenaContent* arenaContent =
+        elementsArena != NULL ? (ListElementsArenaContent*)elementsArena->arenaContent : NULL;
+
+    ASSERT(elementsArena == NULL || (arenaContent != NULL && arenaContent->firstBlock != NULL),
+           "Invalid arena content!");
+
+    if (arenaContent != NULL && arenaContent->firstBlock != NULL)
+    {
+        deleteArenaBlocks(arenaContent->firstBlock->next);
+        arenaContent->firstBlock->next = NULL;
+        arenaContent->firstBlock->usedElementsCount = 0;
+        arenaContent->currentBlock = arenaContent->firstBlock;
+        arenaContent->aquiredElementsCount = 0;
+    }
+}
+
+size_t getArenaAquiredElementsCount(ListElementsArena* elementsArena)
+{
+    const ListElementsArenaContent* arenaContent =
+        elementsArena != NULL ? (ListElementsArenaContent*)elementsArena->arenaContent : NULL;
+    ASSERT(elementsArena == NULL || arenaContent != NULL, "Invalid arena content!");
+
+    return arenaContent != NULL ? arenaContent->aquiredElementsCount : 0;
+}
+
+const ListElementsAllocator* getArenaElementsAllocator()
+{
+    return &arenaElementsAllocator;
+}
+
+static ListElement* aquireArenaElement(void* context)
+{
+    ListElement* aquiredElement = NULL;
+    ListElementsArena* elementsArena = (ListElementsArena*)context;
+    ListElementsArenaContent* arenaContent =
+        elementsArena != NULL ? (ListElementsArenaContent*)elementsArena->arenaContent : NULL;
+    ArenaBlock* currentBlock = arenaContent != NULL ? arenaContent->currentBlock : NULL;
+
+    ASSERT(currentBlock != NULL, "Invalid arena!");
+
+    if (currentBlock != NULL && currentBlock->usedElementsCount == arenaContent->blockSize)
+    {
+        currentBlock->next = createArenaBlock(arenaContent->blockSize);
+        currentBlock = currentBlock->next;
+        arenaContent->currentBlock = currentBlock != NULL ? currentBlock : arenaContent->currentBlock;
+    }
+
+    if (currentBlock != NULL)
+    {
+        aquiredElement = &currentBlock->elements[currentBlock->usedElementsCount];
+        initListElement(aquiredElement);
+        ++currentBlock->usedElementsCount;
+        ++arenaContent->aquiredElementsCount;
+    }
+
+    return aquiredElement;
+}
+
+/* The elements are aquired one by one, the bump allocation is cheap enough
+   - if a new block cannot be created the elements aquired so far remain in use until the next arena reset
+*/
+static bool aquireArenaElements(void* context, ListElement** elements, size_t requiredElementsCount)
+{
+    bool success = elements != NULL && requiredElementsCount > 0;
+
+    for (size_t index = 0; success && index < requiredElementsCount; ++index)
+    {
+        elements[index] = aquireArenaElement(context);
+        success = elements[index] != NULL;
+    }
+
+    return success;
+}
+
+// no-op: the elements are only recycled when resetting the arena
+static bool releaseArenaElement(void* context, ListElement* element)
+{
+    (void)context;
+
+    return element != NULL;
+}
+
+static bool releaseArenaElements(void* context, ListElement* first, ListElement* last, size_t elementsCount)
+{
+    (void)context;
+
+    return first != NULL && last != NULL && elementsCount > 0;
+}
+
+static ArenaBlock* createArenaBlock(size_t blockSize)
+{
+    ArenaBlock* block = (ArenaBlock*)malloc(sizeof(ArenaBlock) + blockSize * sizeof(ListElement));
+
+    if (block != NULL)
+    {
+        block->next = NULL;
+        block->usedElementsCount = 0;
+    }
+
+    return block;
+}
+
+static void deleteArenaBlocks(ArenaBlock* firstBlock)
+{
+    ArenaBlock* currentBlock = firstBlock;
+
+    while (currentBlock != NULL)
+    {
+        ArenaBlock* blockToDelete = currentBlock;
+        currentBlock = currentBlock->next;
+        free(blockToDelete);
+    }
+}
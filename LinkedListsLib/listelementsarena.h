@@ -0,0 +1,35 @@
+#pragma once
+
+#include "listelementspoolproxy.h"
+
+#define ARENA_DEFAULT_BLOCK_SIZE 1024
+
+/* The list elements arena hands out elements by bumping a pointer within fixed size blocks of elements
+   - a new block is allocated when the current one got exhausted, there is no upper limit for the number of blocks
+   - releasing elements is a no-op, the elements are only recycled by resetting the arena
+   - resetting releases all blocks except the first one, which is kept for reuse; all elements aquired previously become
+   invalid (the lists using them should be cleared or detached prior to reset, clearing is only required for
+   de-allocating the objects of the elements)
+   - intended for short-lived lists that get built, used and dropped together (e.g. per-request scratch lists)
+   - lists connect to the arena by using the arena allocator (getArenaElementsAllocator()) with the arena as context
+*/
+typedef struct
+{
+    void* arenaContent;
+} ListElementsArena;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    ListElementsArena* createListElementsArena(size_t blockSize); // 0: ARENA_DEFAULT_BLOCK_SIZE elements per block
+    void deleteListElementsArena(ListElementsArena* elementsArena);
+    void resetListElementsArena(ListElementsArena* elementsArena);
+    size_t getArenaAquiredElementsCount(ListElementsArena* elementsArena);
+
+    const ListElementsAllocator* getArenaElementsAllocator(); // context: ListElementsArena
+
+#ifdef __cplusplus
+}
+#endif
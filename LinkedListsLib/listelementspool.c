@@ -1,12 +1,23 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 #include "bitoperations.h"
+#include "codeutils.h"
 #include "error.h"
 #include "listelementspool.h"
 
+#ifdef UNIX_OS
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #define DEFAULT_MAX_SLICES_COUNT 8
 #define SLICE_OFFSET 4
+#define FLAGS_WORD_MSB_MASK ((uint64_t)1 << 63)
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024) // most common huge page size (x86-64, AArch64 with 4 KiB base pages)
+#define SLICE_DATA_ALIGNMENT 64          // slices of a mapped region start at cache line boundaries
 
 typedef struct
 {
@@ -20,7 +31,7 @@ typedef struct
     byte_t* availabilityFlags;
     size_t totalElementsCount;
     size_t availableElementsCount;
-    void* data; // heap data allocated to slice, used only for allocation/deallocation purposes
+    void* data; // heap data allocated to slice, used only for allocation/deallocation purposes (NULL if mapped)
 } ListElementsSlice;
 
 typedef struct
@@ -31,23 +42,54 @@ typedef struct
     size_t availableElementsCount;
     size_t slicesCount;
     size_t maximumSlicesCount;
+    ElementsAquiringPolicy aquiringPolicy;
+    byte_t* slicesRegion; // memory reserved upfront for all slices (mapped backing only)
+    size_t slicesRegionSize;
+    size_t sliceDataSize;        // distance between consecutive slices within the mapped region
+    ListElementsPoolStats stats; // the slices occupancy is only computed when the stats are requested
+    size_t latencySamplingPeriod;
+    size_t aquiringCallsCount;
+    uint64_t totalSampledAquiringLatency;
 } ListElementsPoolContent;
 
 // "private" (supporting) functions
-static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlicesCount);
+static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlicesCount, ElementsPoolBacking backing);
 static void addSliceToElementsPool(ListElementsPool* elementsPool);
 static void deleteUnusedSlices(ListElementsPool* elementsPool);
+static void fillSliceElementIds(SliceElementId* sliceElementIds, ListElementsSlice** elementSlices,
+                                size_t slicesCount);
+static size_t aquireLowestAddressElements(ListElementsPoolContent* poolContent, ListElement** elements,
+                                          size_t requiredElementsCount);
+static size_t aquireLowestAddressSliceElements(ListElementsSlice* slice, ListElement** elements,
+                                               size_t requiredElementsCount);
+static ListElementsSlice* getMostPopulatedSlice(const ListElementsPoolContent* poolContent);
+static bool relocateListElements(ListElementsPool* elementsPool, List* list, const bool* isTargetSlice);
+static uint64_t loadAvailabilityFlagsWord(const byte_t* availabilityFlags, size_t bytesCount);
+static size_t getLeadingZeroBitsCount(uint64_t word);
 static bool retrieveSliceIndex(const ListElement* element, const ListElementsPool* elementsPool, size_t* sliceIndex);
-static ListElementsSlice* createSlice(size_t elementsCount);
+static uint64_t startAquiringLatencySample(ListElementsPoolContent* poolContent);
+static void updateAquiringStats(ListElementsPoolContent* poolContent, size_t aquiredElementsCount,
+                                size_t requiredElementsCount, uint64_t samplingStartTime);
+static uint64_t getMonotonicTime();
+static ListElementsSlice* createSlice(size_t elementsCount, void* mappedData);
 static void deleteSlice(ListElementsSlice* slice);
+static size_t getSliceDataSize(size_t elementsCount);
+static void* getFreeSlicesRegionSlot(const ListElementsPoolContent* poolContent);
+static byte_t* mapSlicesRegion(size_t* regionSize);
+static void unmapSlicesRegion(byte_t* region, size_t regionSize);
 
 ListElementsPool* createListElementsPool(size_t maxSlicesCount)
+{
+    return createListElementsPoolWithBacking(maxSlicesCount, HEAP_POOL_BACKING);
+}
+
+ListElementsPool* createListElementsPoolWithBacking(size_t maxSlicesCount, ElementsPoolBacking backing)
 {
     ListElementsPool* elementsPool = (ListElementsPool*)malloc(sizeof(ListElementsPool));
 
     if (elementsPool != NULL)
     {
-        const bool success = initListElementsPool(elementsPool, maxSlicesCount);
+        const bool success = initListElementsPool(elementsPool, maxSlicesCount, backing);
 
         if (!success)
         {
@@ -66,6 +108,8 @@ void deleteListElementsPool(ListElementsPool* elementsPool)
     ListElementsSlice** elementSlices = poolContent != NULL ? poolContent->elementSlices : NULL;
     SliceElementId* sliceElementIds = poolContent != NULL ? poolContent->sliceElementIds : NULL;
     const size_t slicesCount = poolContent != NULL ? poolContent->slicesCount : 0;
+    byte_t* slicesRegion = poolContent != NULL ? poolContent->slicesRegion : NULL;
+    const size_t slicesRegionSize = poolContent != NULL ? poolContent->slicesRegionSize : 0;
 
     ASSERT(elementsPool == NULL || (elementSlices != NULL && sliceElementIds != NULL && slicesCount > 0),
            "Invalid pool content!");
@@ -86,12 +130,14 @@ void deleteListElementsPool(ListElementsPool* elementsPool)
     }
 
     FREE(sliceElementIds);
+    unmapSlicesRegion(slicesRegion, slicesRegionSize);
 }
 
 ListElement* aquireElement(ListElementsPool* elementsPool)
 {
     ListElement* aquiredElement = NULL;
     ListElementsPoolContent* poolContent = elementsPool != NULL ? elementsPool->poolContent : NULL;
+    const uint64_t samplingStartTime = startAquiringLatencySample(poolContent);
 
     if (poolContent != NULL && poolContent->availableElementsCount == 0)
     {
@@ -104,7 +150,13 @@ ListElement* aquireElement(ListElementsPool* elementsPool)
     ASSERT(elementsPool == NULL || (elementSlices != NULL && sliceElementIds != NULL),
            "Invalid list elements pool content!");
 
-    if (elementSlices != NULL && sliceElementIds != NULL && poolContent->availableElementsCount > 0)
+    if (elementSlices != NULL && sliceElementIds != NULL && poolContent->availableElementsCount > 0 &&
+        poolContent->aquiringPolicy == LOCALITY_AQUIRING_POLICY)
+    {
+        const size_t aquiredElementsCount = aquireLowestAddressElements(poolContent, &aquiredElement, 1);
+        ASSERT(aquiredElementsCount == 1, "NULL element to aquire detected!");
+    }
+    else if (elementSlices != NULL && sliceElementIds != NULL && poolContent->availableElementsCount > 0)
     {
         ListElementsSlice* slice = NULL;
         ListElement* lastAvailableSliceElement = NULL;
@@ -139,6 +191,8 @@ ListElement* aquireElement(ListElementsPool* elementsPool)
         }
     }
 
+    updateAquiringStats(poolContent, aquiredElement != NULL ? 1 : 0, 1, samplingStartTime);
+
     return aquiredElement;
 }
 
@@ -148,6 +202,7 @@ bool aquireElements(ListElementsPool* elementsPool, ListElement** elements, size
     ListElementsPoolContent* poolContent =
         elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
     bool canRequiredElementsCountBeAquired = false;
+    const uint64_t samplingStartTime = startAquiringLatencySample(poolContent);
 
     if (poolContent != NULL && elements != NULL && requiredElementsCount > 0)
     {
@@ -174,7 +229,13 @@ bool aquireElements(ListElementsPool* elementsPool, ListElement** elements, size
     ASSERT(elementsPool == NULL || (elementSlices != NULL && sliceElementIds != NULL),
            "Invalid list elements pool content!");
 
-    if (canRequiredElementsCountBeAquired && elementSlices != NULL && sliceElementIds != NULL)
+    if (canRequiredElementsCountBeAquired && elementSlices != NULL && sliceElementIds != NULL &&
+        poolContent->aquiringPolicy == LOCALITY_AQUIRING_POLICY)
+    {
+        const size_t aquiredElementsCount = aquireLowestAddressElements(poolContent, elements, requiredElementsCount);
+        success = aquiredElementsCount == requiredElementsCount;
+    }
+    else if (canRequiredElementsCountBeAquired && elementSlices != NULL && sliceElementIds != NULL)
     {
         size_t aquiredElementsCount = 0;
 
@@ -224,6 +285,9 @@ bool aquireElements(ListElementsPool* elementsPool, ListElement** elements, size
         success = aquiredElementsCount == requiredElementsCount;
     }
 
+    updateAquiringStats(poolContent, success ? requiredElementsCount : 0, elements != NULL ? requiredElementsCount : 0,
+                        samplingStartTime);
+
     return success;
 }
 
@@ -279,6 +343,7 @@ bool releaseElement(ListElement* element, ListElementsPool* elementsPool)
                 availabilityFlags[byteIndex] |= elementBitMask; // set bit, element is available again for aquiring
                 ++slice->availableElementsCount;
                 ++poolContent->availableElementsCount;
+                ++poolContent->stats.releasedElementsCount;
                 success = true;
             }
         }
@@ -287,6 +352,111 @@ bool releaseElement(ListElement* element, ListElementsPool* elementsPool)
     return success;
 }
 
+/* Bulk alternative to releaseElement() for a chain of linked elements (e.g. the content of a list)
+   - the slice of the previously released element is kept so the slice lookup is only performed when the chain
+   crosses into another slice
+   - the available elements count of each slice is updated once per run of consecutive elements from the same slice
+   - each element is reset while being walked through (no separate initListElement() pass)
+   - it is assumed that a cleanup of the object data has been performed prior to releasing the elements
+*/
+bool releaseElements(ListElementsPool* elementsPool, ListElement* first, ListElement* last, size_t elementsCount)
+{
+    bool success = false;
+    ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ListElementsSlice** elementSlices = poolContent != NULL ? poolContent->elementSlices : NULL;
+    SliceElementId* sliceElementIds = poolContent != NULL ? poolContent->sliceElementIds : NULL;
+
+    ASSERT(elementsPool == NULL || (elementSlices != NULL && sliceElementIds != NULL),
+           "Invalid list elements pool content!");
+
+    const bool canElementsBeReleased = elementSlices != NULL && sliceElementIds != NULL && first != NULL &&
+                                       last != NULL && elementsCount > 0 &&
+                                       poolContent->availableElementsCount + elementsCount <=
+                                           poolContent->totalElementsCount;
+
+    if (canElementsBeReleased)
+    {
+        ListElementsSlice* currentSlice = NULL;
+        size_t currentSliceIndex = 0;
+        size_t releasedFromCurrentSliceCount = 0;
+        size_t releasedElementsCount = 0;
+        ListElement* currentElement = first;
+        ListElement* lastWalkedElement = NULL;
+
+        for (size_t walkedElementsCount = 0; walkedElementsCount < elementsCount && currentElement != NULL;
+             ++walkedElementsCount)
+        {
+            ListElement* nextElement = currentElement->next;
+            const bool isInCurrentSlice = currentSlice != NULL && currentElement >= currentSlice->elements &&
+                                          currentElement < currentSlice->elements + currentSlice->totalElementsCount;
+
+            if (!isInCurrentSlice)
+            {
+                if (currentSlice != NULL)
+                {
+                    currentSlice->availableElementsCount += releasedFromCurrentSliceCount;
+                    releasedFromCurrentSliceCount = 0;
+                }
+
+                currentSlice = retrieveSliceIndex(currentElement, elementsPool, &currentSliceIndex)
+                                   ? elementSlices[currentSliceIndex]
+                                   : NULL;
+            }
+
+            ASSERT(currentSlice != NULL && currentSlice->availabilityFlags != NULL,
+                   "Element not contained in elements pool!");
+
+            if (currentSlice != NULL && currentSlice->availabilityFlags != NULL)
+            {
+                const size_t sliceElementIndex = currentElement - currentSlice->elements;
+                const size_t byteIndex = sliceElementIndex / BYTE_SIZE;
+                const size_t bitIndex =
+                    BYTE_SIZE - 1 - sliceElementIndex % BYTE_SIZE; // bits are numbered from byte end (least
+                                                                   // significant: 0) to beginning (most significant: 7)
+                const byte_t elementBitMask = LSB_MASK << bitIndex;
+                const bool canElementBeAquired = currentSlice->availabilityFlags[byteIndex] & elementBitMask;
+
+                ASSERT(!canElementBeAquired, "Attempt to release an element that has not been aquired!");
+
+                // only already aquired elements can be released
+                if (!canElementBeAquired)
+                {
+                    SliceElementId* releasedSliceElementId =
+                        &sliceElementIds[poolContent->availableElementsCount + releasedElementsCount];
+
+                    currentElement->next = NULL;
+                    currentElement->priority = 0;
+                    currentElement->object.type = -1;
+                    currentElement->object.payload = NULL;
+
+                    releasedSliceElementId->sliceIndex = currentSliceIndex;
+                    releasedSliceElementId->sliceElementIndex = sliceElementIndex;
+                    currentSlice->availabilityFlags[byteIndex] |= elementBitMask;
+                    ++releasedFromCurrentSliceCount;
+                    ++releasedElementsCount;
+                }
+            }
+
+            lastWalkedElement = currentElement;
+            currentElement = nextElement;
+        }
+
+        if (currentSlice != NULL)
+        {
+            currentSlice->availableElementsCount += releasedFromCurrentSliceCount;
+        }
+
+        ASSERT(lastWalkedElement == last, "The elements count does not match the elements chain!");
+
+        poolContent->availableElementsCount += releasedElementsCount;
+        poolContent->stats.releasedElementsCount += releasedElementsCount;
+        success = releasedElementsCount == elementsCount && lastWalkedElement == last;
+    }
+
+    return success;
+}
+
 void shrinkPoolCapacity(ListElementsPool* elementsPool)
 {
     ListElementsPoolContent* poolContent =
@@ -300,6 +470,245 @@ void shrinkPoolCapacity(ListElementsPool* elementsPool)
     }
 }
 
+/* Moves the aquired elements out of the least populated slices into the most populated ones and deletes the slices that
+   got emptied
+   - the minimum number of slices able to hold all aquired elements (plus at least one available element) is kept
+   - all aquired elements should belong to the passed lists, otherwise no compaction is performed (elements referenced
+   from elsewhere would be invalidated); the elements from the recycle caches of the lists are released to the pool
+   - the links between the list elements and the first/last references of the lists are updated, any other element
+   references (iterators, pointers) to the lists content become invalid
+*/
+bool compactListElementsPool(ListElementsPool* elementsPool, List** lists, size_t listsCount)
+{
+    bool success = false;
+    ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ListElementsSlice** elementSlices = poolContent != NULL ? poolContent->elementSlices : NULL;
+
+    ASSERT(elementsPool == NULL || (elementSlices != NULL && poolContent->sliceElementIds != NULL),
+           "Invalid list elements pool content!");
+
+    bool areAllAquiredElementsContained = elementSlices != NULL && (lists != NULL || listsCount == 0);
+    size_t listedElementsCount = 0;
+
+    // the elements cached for recycling by the lists are aquired too
+    for (size_t listIndex = 0; areAllAquiredElementsContained && listIndex < listsCount; ++listIndex)
+    {
+        const List* list = lists[listIndex];
+        areAllAquiredElementsContained =
+            list != NULL && ((list->first == NULL && list->recycledElements == NULL) ||
+                             list->elementsPoolProxy.context == elementsPool);
+        listedElementsCount +=
+            areAllAquiredElementsContained ? getListSize(list) + getListRecycledElementsCount(list) : 0;
+    }
+
+    areAllAquiredElementsContained =
+        areAllAquiredElementsContained && listedElementsCount == getAquiredElementsCount(elementsPool);
+
+    // cached elements are released to the pool prior to compacting (they might be located in the slices to be deleted)
+    for (size_t listIndex = 0; areAllAquiredElementsContained && listIndex < listsCount; ++listIndex)
+    {
+        List* list = lists[listIndex];
+        const size_t recycleCacheCapacity = list->recycleCacheCapacity;
+
+        setListRecycleCacheCapacity(list, 0);
+        setListRecycleCacheCapacity(list, recycleCacheCapacity);
+    }
+
+    const size_t aquiredElementsCount = elementsPool != NULL ? getAquiredElementsCount(elementsPool) : 0;
+
+    const size_t slicesCount = areAllAquiredElementsContained ? poolContent->slicesCount : 0;
+    bool* isTargetSlice = slicesCount > 0 ? (bool*)calloc(slicesCount, sizeof(bool)) : NULL;
+
+    if (isTargetSlice != NULL)
+    {
+        const size_t targetSlicesCount = aquiredElementsCount / ELEMENTS_POOL_SLICE_SIZE + 1;
+        success = true;
+
+        // the most populated slices become targets (a simple selection is enough, the slices count is low)
+        for (size_t targetIndex = 0; targetIndex < targetSlicesCount && targetIndex < slicesCount; ++targetIndex)
+        {
+            size_t mostPopulatedSliceIndex = slicesCount;
+
+            for (size_t sliceIndex = 0; sliceIndex < slicesCount; ++sliceIndex)
+            {
+                const ListElementsSlice* slice = elementSlices[sliceIndex];
+
+                if (!isTargetSlice[sliceIndex] &&
+                    (mostPopulatedSliceIndex == slicesCount ||
+                     slice->availableElementsCount < elementSlices[mostPopulatedSliceIndex]->availableElementsCount))
+                {
+                    mostPopulatedSliceIndex = sliceIndex;
+                }
+            }
+
+            isTargetSlice[mostPopulatedSliceIndex] = true;
+        }
+
+        for (size_t listIndex = 0; success && listIndex < listsCount; ++listIndex)
+        {
+            success = relocateListElements(elementsPool, lists[listIndex], isTargetSlice);
+        }
+
+        free(isTargetSlice);
+        isTargetSlice = NULL;
+
+        deleteUnusedSlices(elementsPool);
+
+        // IDs should reflect the relocated elements even if no slice could be removed
+        fillSliceElementIds(poolContent->sliceElementIds, poolContent->elementSlices, poolContent->slicesCount);
+    }
+
+    return success;
+}
+
+/* Touches each page of the mapped slices region so no page faults occur when new slices get created
+   - the content of the already used pages is preserved (each touched byte is re-written with its own value)
+   - nothing to be done for heap backed pools (slices are allocated on demand)
+*/
+bool prefaultListElementsPool(ListElementsPool* elementsPool)
+{
+    bool success = false;
+    ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+
+#ifdef UNIX_OS
+    volatile byte_t* slicesRegion = poolContent != NULL ? poolContent->slicesRegion : NULL;
+
+    if (slicesRegion != NULL)
+    {
+        const long pageSize = sysconf(_SC_PAGESIZE);
+        const size_t pageStride = pageSize > 0 ? (size_t)pageSize : 4096;
+
+        for (size_t offset = 0; offset < poolContent->slicesRegionSize; offset += pageStride)
+        {
+            slicesRegion[offset] = slicesRegion[offset];
+        }
+
+        success = true;
+    }
+#else
+    (void)poolContent;
+#endif
+
+    return success;
+}
+
+ElementsPoolBacking getElementsPoolBacking(ListElementsPool* elementsPool)
+{
+    const ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+
+    return poolContent != NULL && poolContent->slicesRegion != NULL ? MAPPED_POOL_BACKING : HEAP_POOL_BACKING;
+}
+
+/* The slice element IDs are only kept up to date for the LIFO policy, so they need to be re-created (based on the
+   availability flags) when switching back to it
+*/
+void setElementsAquiringPolicy(ListElementsPool* elementsPool, ElementsAquiringPolicy aquiringPolicy)
+{
+    ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ASSERT(elementsPool == NULL || poolContent != NULL, "Invalid list elements pool content!");
+
+    if (poolContent != NULL && poolContent->aquiringPolicy != aquiringPolicy)
+    {
+        if (aquiringPolicy == LIFO_AQUIRING_POLICY)
+        {
+            fillSliceElementIds(poolContent->sliceElementIds, poolContent->elementSlices, poolContent->slicesCount);
+        }
+
+        poolContent->aquiringPolicy = aquiringPolicy;
+    }
+}
+
+ElementsAquiringPolicy getElementsAquiringPolicy(ListElementsPool* elementsPool)
+{
+    const ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ASSERT(elementsPool == NULL || poolContent != NULL, "Invalid list elements pool content!");
+
+    return poolContent != NULL ? poolContent->aquiringPolicy : LIFO_AQUIRING_POLICY;
+}
+
+/* The counters are cumulative since pool creation (or the last stats reset)
+   - the slices occupancy reflects the current state of the pool
+   - latency stats are only filled in if sampling has been enabled (see setAquiringLatencySamplingPeriod())
+*/
+bool getListElementsPoolStats(ListElementsPool* elementsPool, ListElementsPoolStats* stats)
+{
+    bool success = false;
+    const ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ASSERT(elementsPool == NULL || (poolContent != NULL && poolContent->elementSlices != NULL),
+           "Invalid list elements pool content!");
+
+    if (poolContent != NULL && poolContent->elementSlices != NULL && stats != NULL)
+    {
+        *stats = poolContent->stats;
+
+        for (size_t bucketIndex = 0; bucketIndex < POOL_OCCUPANCY_BUCKETS_COUNT; ++bucketIndex)
+        {
+            stats->slicesOccupancy[bucketIndex] = 0;
+        }
+
+        // bucket 0: empty slices, the other buckets split the (0, 100%] occupancy range evenly
+        for (size_t sliceIndex = 0; sliceIndex < poolContent->slicesCount; ++sliceIndex)
+        {
+            const ListElementsSlice* slice = poolContent->elementSlices[sliceIndex];
+            const size_t sliceAquiredElementsCount = slice->totalElementsCount - slice->availableElementsCount;
+            const size_t quartersCount = POOL_OCCUPANCY_BUCKETS_COUNT - 1;
+            const size_t bucketIndex =
+                sliceAquiredElementsCount > 0
+                    ? 1 + (sliceAquiredElementsCount * quartersCount - 1) / slice->totalElementsCount
+                    : 0;
+
+            ++stats->slicesOccupancy[bucketIndex];
+        }
+
+        stats->averageAquiringLatency = poolContent->stats.sampledAquiringsCount > 0
+                                            ? poolContent->totalSampledAquiringLatency /
+                                                  poolContent->stats.sampledAquiringsCount
+                                            : 0;
+        success = true;
+    }
+
+    return success;
+}
+
+// the peak aquired elements count restarts from the current aquired elements count
+void resetListElementsPoolStats(ListElementsPool* elementsPool)
+{
+    ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ASSERT(elementsPool == NULL || poolContent != NULL, "Invalid list elements pool content!");
+
+    if (poolContent != NULL)
+    {
+        memset(&poolContent->stats, 0, sizeof(ListElementsPoolStats));
+        poolContent->stats.peakAquiredElementsCount = getAquiredElementsCount(elementsPool);
+        poolContent->aquiringCallsCount = 0;
+        poolContent->totalSampledAquiringLatency = 0;
+    }
+}
+
+/* Every samplingPeriod-th aquiring call (aquireElement() or aquireElements()) gets its duration measured
+   - the sampling is disabled by setting a 0 period (default)
+   - a period of 1 measures all calls; larger periods keep the overhead low (two clock reads per sample)
+*/
+void setAquiringLatencySamplingPeriod(ListElementsPool* elementsPool, size_t samplingPeriod)
+{
+    ListElementsPoolContent* poolContent =
+        elementsPool != NULL ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ASSERT(elementsPool == NULL || poolContent != NULL, "Invalid list elements pool content!");
+
+    if (poolContent != NULL)
+    {
+        poolContent->latencySamplingPeriod = samplingPeriod;
+        poolContent->aquiringCallsCount = 0;
+    }
+}
+
 size_t getAvailableElementsCount(ListElementsPool* elementsPool)
 {
     const ListElementsPoolContent* poolContent =
@@ -325,7 +734,7 @@ size_t getAquiredElementsCount(ListElementsPool* elementsPool)
     return aquiredElementsCount;
 }
 
-static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlicesCount)
+static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlicesCount, ElementsPoolBacking backing)
 {
     static_assert(ELEMENTS_POOL_SLICE_SIZE > 0 && ELEMENTS_POOL_SLICE_SIZE % BYTE_SIZE == 0, "Invalid slice size!");
     static_assert(DEFAULT_MAX_SLICES_COUNT > 0, "The default number of slices should not be 0!");
@@ -340,9 +749,15 @@ static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlice
     ListElementsSlice** elementSlices =
         poolContent != NULL ? (ListElementsSlice**)malloc(maximumSlicesCount * sizeof(ListElementsSlice*)) : NULL;
 
+    // if mapping fails the pool falls back to heap backing
+    const size_t sliceDataSize = getSliceDataSize(ELEMENTS_POOL_SLICE_SIZE);
+    size_t slicesRegionSize = maximumSlicesCount * sliceDataSize;
+    byte_t* slicesRegion =
+        elementSlices != NULL && backing == MAPPED_POOL_BACKING ? mapSlicesRegion(&slicesRegionSize) : NULL;
+
     if (elementSlices != NULL)
     {
-        elementSlices[0] = createSlice(totalElementsCount);
+        elementSlices[0] = createSlice(totalElementsCount, slicesRegion);
 
         if (elementSlices[0] != NULL)
         {
@@ -371,6 +786,15 @@ static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlice
         poolContent->availableElementsCount = poolContent->totalElementsCount;
         poolContent->slicesCount = 1;
         poolContent->maximumSlicesCount = maximumSlicesCount;
+        poolContent->aquiringPolicy = LIFO_AQUIRING_POLICY;
+        poolContent->slicesRegion = slicesRegion;
+        poolContent->slicesRegionSize = slicesRegion != NULL ? slicesRegionSize : 0;
+        poolContent->sliceDataSize = sliceDataSize;
+        memset(&poolContent->stats, 0, sizeof(ListElementsPoolStats));
+        poolContent->stats.createdSlicesCount = 1;
+        poolContent->latencySamplingPeriod = 0;
+        poolContent->aquiringCallsCount = 0;
+        poolContent->totalSampledAquiringLatency = 0;
         elementsPool->poolContent = poolContent;
     }
 
@@ -388,6 +812,7 @@ static bool initListElementsPool(ListElementsPool* elementsPool, size_t maxSlice
         }
 
         FREE(sliceElementIds);
+        unmapSlicesRegion(slicesRegion, slicesRegionSize);
     }
 
     return success;
@@ -407,7 +832,8 @@ static void addSliceToElementsPool(ListElementsPool* elementsPool)
 
     const bool canCreateNewSlice =
         elementSlices != NULL && sliceElementIds != NULL && poolContent->slicesCount < poolContent->maximumSlicesCount;
-    ListElementsSlice* newSlice = canCreateNewSlice ? createSlice(ELEMENTS_POOL_SLICE_SIZE) : NULL;
+    ListElementsSlice* newSlice =
+        canCreateNewSlice ? createSlice(ELEMENTS_POOL_SLICE_SIZE, getFreeSlicesRegionSlot(poolContent)) : NULL;
     const size_t newTotalElementsCount =
         newSlice != NULL ? totalElementsCount + newSlice->totalElementsCount : totalElementsCount;
     SliceElementId* newSliceElementIds =
@@ -431,6 +857,7 @@ static void addSliceToElementsPool(ListElementsPool* elementsPool)
         poolContent->totalElementsCount = newTotalElementsCount;
         poolContent->availableElementsCount += newSlice->totalElementsCount;
         ++poolContent->slicesCount;
+        ++poolContent->stats.createdSlicesCount;
     }
     else
     {
@@ -503,50 +930,262 @@ static void deleteUnusedSlices(ListElementsPool* elementsPool)
     // if slice element IDs cannot be resized the old slice element IDs remain (still valid)
     if (newSliceElementIds != NULL)
     {
-        size_t sliceElementIdIndex = 0;
+        fillSliceElementIds(newSliceElementIds, elementSlices, nrOfSlicesLeftAfterRemoval);
+        poolContent->sliceElementIds = newSliceElementIds;
+    }
 
-        for (size_t sliceIndex = 0; sliceIndex < nrOfSlicesLeftAfterRemoval; ++sliceIndex)
+    if (nrOfSlicesLeftAfterRemoval < slicesCount)
+    {
+        poolContent->stats.deletedSlicesCount += slicesCount - nrOfSlicesLeftAfterRemoval;
+        poolContent->slicesCount = nrOfSlicesLeftAfterRemoval;
+        const size_t elementsCountDelta = poolContent->totalElementsCount - nrOfElementsLeftAfterRemoval;
+        poolContent->totalElementsCount = nrOfElementsLeftAfterRemoval;
+        ASSERT(poolContent->availableElementsCount >= elementsCountDelta, "Invalid available elements count!");
+        poolContent->availableElementsCount = poolContent->availableElementsCount >= elementsCountDelta
+                                                  ? poolContent->availableElementsCount - elementsCountDelta
+                                                  : 0;
+    }
+}
+
+// the IDs of the available elements are written in ascending order of their slice (element) index
+static void fillSliceElementIds(SliceElementId* sliceElementIds, ListElementsSlice** elementSlices,
+                                size_t slicesCount)
+{
+    size_t sliceElementIdIndex = 0;
+
+    for (size_t sliceIndex = 0; sliceIndex < slicesCount; ++sliceIndex)
+    {
+        ListElementsSlice* slice = elementSlices[sliceIndex];
+
+        if (slice == NULL || slice->availabilityFlags == NULL)
+        {
+            ASSERT(false, "Invalid slice!");
+            break;
+        }
+
+        for (size_t sliceElementIndex = 0; sliceElementIndex < slice->totalElementsCount; ++sliceElementIndex)
+        {
+            const size_t byteIndex = sliceElementIndex / BYTE_SIZE;
+            const size_t bitIndex =
+                BYTE_SIZE - 1 - sliceElementIndex % BYTE_SIZE; // bits are numbered from byte end (least
+                                                               // significant: 0) to beginning (most significant: 7)
+            const byte_t elementBitMask = LSB_MASK << bitIndex;
+            const bool canElementBeAquired =
+                slice->availabilityFlags[byteIndex] & elementBitMask; // test element availability bit
+
+            if (canElementBeAquired)
+            {
+                sliceElementIds[sliceElementIdIndex].sliceIndex = sliceIndex;
+                sliceElementIds[sliceElementIdIndex].sliceElementIndex = sliceElementIndex;
+                ++sliceElementIdIndex;
+            }
+        }
+    }
+}
+
+/* Aquiring based on the LOCALITY policy (the caller should ensure enough elements are available)
+   - the most populated slice is re-evaluated only once the current one got filled in
+*/
+static size_t aquireLowestAddressElements(ListElementsPoolContent* poolContent, ListElement** elements,
+                                          size_t requiredElementsCount)
+{
+    size_t aquiredElementsCount = 0;
+
+    while (poolContent != NULL && elements != NULL && aquiredElementsCount < requiredElementsCount)
+    {
+        ListElementsSlice* slice = getMostPopulatedSlice(poolContent);
+        const size_t aquiredSliceElementsCount = aquireLowestAddressSliceElements(
+            slice, elements + aquiredElementsCount, requiredElementsCount - aquiredElementsCount);
+
+        if (aquiredSliceElementsCount == 0)
+        {
+            ASSERT(false, "No valid slice with available elements found!");
+            break;
+        }
+
+        poolContent->availableElementsCount -= aquiredSliceElementsCount;
+        aquiredElementsCount += aquiredSliceElementsCount;
+    }
+
+    return aquiredElementsCount;
+}
+
+/* Aquires the available elements of the slice in ascending address order (only the slice elements count gets updated)
+   - the availability flags are scanned a word (8 bytes) at a time; as the first element of a byte is represented by
+   its most significant bit, the first flags byte is loaded as most significant word byte so the index of the lowest
+   address available element is given by the count of leading zero bits
+*/
+static size_t aquireLowestAddressSliceElements(ListElementsSlice* slice, ListElement** elements,
+                                               size_t requiredElementsCount)
+{
+    size_t aquiredElementsCount = 0;
+    const bool isSliceValid = slice != NULL && slice->elements != NULL && slice->availabilityFlags != NULL;
+
+    ASSERT(slice == NULL || isSliceValid, "Invalid slice!");
+
+    const size_t flagsCount = isSliceValid && elements != NULL ? slice->totalElementsCount / BYTE_SIZE : 0;
+    size_t flagsIndex = 0;
+
+    while (flagsIndex < flagsCount && slice->availableElementsCount > 0 &&
+           aquiredElementsCount < requiredElementsCount)
+    {
+        const size_t remainingFlagsCount = flagsCount - flagsIndex;
+        const size_t wordBytesCount = remainingFlagsCount < sizeof(uint64_t) ? remainingFlagsCount : sizeof(uint64_t);
+        uint64_t flagsWord = loadAvailabilityFlagsWord(slice->availabilityFlags + flagsIndex, wordBytesCount);
+
+        while (flagsWord != 0 && aquiredElementsCount < requiredElementsCount)
         {
-            ListElementsSlice* slice = elementSlices[sliceIndex];
+            const size_t bitOffset = getLeadingZeroBitsCount(flagsWord);
+            const size_t sliceElementIndex = flagsIndex * BYTE_SIZE + bitOffset;
+            const size_t bitIndex =
+                BYTE_SIZE - 1 - sliceElementIndex % BYTE_SIZE; // bits are numbered from byte end (least
+                                                               // significant: 0) to beginning (most significant: 7)
+            const byte_t elementBitMask = LSB_MASK << bitIndex;
+
+            flagsWord &= ~(FLAGS_WORD_MSB_MASK >> bitOffset);
+            slice->availabilityFlags[sliceElementIndex / BYTE_SIZE] &=
+                ~elementBitMask; // bit of the element set to 0, element is aquired (hence unavailable)
+            elements[aquiredElementsCount] = &slice->elements[sliceElementIndex];
+            --slice->availableElementsCount;
+            ++aquiredElementsCount;
+        }
+
+        flagsIndex += wordBytesCount;
+    }
+
+    return aquiredElementsCount;
+}
+
+// the slice with the lowest (non-zero) number of available elements
+static ListElementsSlice* getMostPopulatedSlice(const ListElementsPoolContent* poolContent)
+{
+    ListElementsSlice* mostPopulatedSlice = NULL;
+    const size_t slicesCount = poolContent != NULL && poolContent->elementSlices != NULL ? poolContent->slicesCount : 0;
+
+    for (size_t sliceIndex = 0; sliceIndex < slicesCount; ++sliceIndex)
+    {
+        ListElementsSlice* slice = poolContent->elementSlices[sliceIndex];
+
+        if (slice == NULL)
+        {
+            ASSERT(false, "NULL slice!");
+            break;
+        }
+
+        if (slice->availableElementsCount > 0 &&
+            (mostPopulatedSlice == NULL || slice->availableElementsCount < mostPopulatedSlice->availableElementsCount))
+        {
+            mostPopulatedSlice = slice;
+        }
+    }
+
+    return mostPopulatedSlice;
+}
+
+// first flags byte becomes the most significant byte of the word, missing bytes (if less than 8) are filled in with 0
+static uint64_t loadAvailabilityFlagsWord(const byte_t* availabilityFlags, size_t bytesCount)
+{
+    uint64_t flagsWord = 0;
+
+    for (size_t byteIndex = 0; byteIndex < sizeof(uint64_t); ++byteIndex)
+    {
+        flagsWord = (flagsWord << BYTE_SIZE) | (byteIndex < bytesCount ? availabilityFlags[byteIndex] : 0);
+    }
+
+    return flagsWord;
+}
+
+static size_t getLeadingZeroBitsCount(uint64_t word)
+{
+    ASSERT(word != 0, "The leading zero bits count is undefined for 0!");
+
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_clzll(word);
+#else
+    size_t leadingZeroBitsCount = 0;
+
+    while ((word & FLAGS_WORD_MSB_MASK) == 0)
+    {
+        word <<= 1;
+        ++leadingZeroBitsCount;
+    }
+
+    return leadingZeroBitsCount;
+#endif
+}
+
+// moves the list elements contained in non-target slices to the lowest address available elements of target slices
+static bool relocateListElements(ListElementsPool* elementsPool, List* list, const bool* isTargetSlice)
+{
+    bool success = elementsPool != NULL && list != NULL && isTargetSlice != NULL;
+    ListElementsPoolContent* poolContent = success ? (ListElementsPoolContent*)elementsPool->poolContent : NULL;
+    ListElement* previousElement = NULL;
+    ListElement* currentElement = success ? list->first : NULL;
+    size_t targetSliceIndex = 0;
+
+    while (currentElement != NULL)
+    {
+        size_t sliceIndex = 0;
+
+        if (!retrieveSliceIndex(currentElement, elementsPool, &sliceIndex))
+        {
+            ASSERT(false, "List element not contained in elements pool!");
+            success = false;
+            break;
+        }
+
+        if (!isTargetSlice[sliceIndex])
+        {
+            ListElement* relocatedElement = NULL;
+
+            while (targetSliceIndex < poolContent->slicesCount &&
+                   (!isTargetSlice[targetSliceIndex] ||
+                    aquireLowestAddressSliceElements(poolContent->elementSlices[targetSliceIndex], &relocatedElement,
+                                                     1) == 0))
+            {
+                ++targetSliceIndex;
+            }
 
-            if (slice == NULL || slice->availabilityFlags == NULL)
+            if (relocatedElement == NULL)
             {
-                ASSERT(false, "Invalid slice!");
+                ASSERT(false, "Insufficient available elements in target slices!");
+                success = false;
                 break;
             }
 
-            for (size_t sliceElementIndex = 0; sliceElementIndex < slice->totalElementsCount; ++sliceElementIndex)
+            ListElementsSlice* slice = poolContent->elementSlices[sliceIndex];
+            const size_t sliceElementIndex = currentElement - slice->elements;
+            const size_t bitIndex =
+                BYTE_SIZE - 1 - sliceElementIndex % BYTE_SIZE; // bits are numbered from byte end (least significant:
+                                                               // 0) to beginning (most significant: 7)
+
+            *relocatedElement = *currentElement;
+            initListElement(currentElement);
+            slice->availabilityFlags[sliceElementIndex / BYTE_SIZE] |= LSB_MASK << bitIndex;
+            ++slice->availableElementsCount;
+
+            if (previousElement != NULL)
             {
-                const size_t byteIndex = sliceElementIndex / BYTE_SIZE;
-                const size_t bitIndex =
-                    BYTE_SIZE - 1 - sliceElementIndex % BYTE_SIZE; // bits are numbered from byte end (least
-                                                                   // significant: 0) to beginning (most significant: 7)
-                const byte_t elementBitMask = LSB_MASK << bitIndex;
-                const bool canElementBeAquired =
-                    slice->availabilityFlags[byteIndex] & elementBitMask; // test element availability bit
+                previousElement->next = relocatedElement;
+            }
+            else
+            {
+                list->first = relocatedElement;
+            }
 
-                if (canElementBeAquired)
-                {
-                    newSliceElementIds[sliceElementIdIndex].sliceIndex = sliceIndex;
-                    newSliceElementIds[sliceElementIdIndex].sliceElementIndex = sliceElementIndex;
-                    ++sliceElementIdIndex;
-                }
+            if (list->last == currentElement)
+            {
+                list->last = relocatedElement;
             }
+
+            currentElement = relocatedElement;
         }
 
-        poolContent->sliceElementIds = newSliceElementIds;
+        previousElement = currentElement;
+        currentElement = currentElement->next;
     }
 
-    if (nrOfSlicesLeftAfterRemoval < slicesCount)
-    {
-        poolContent->slicesCount = nrOfSlicesLeftAfterRemoval;
-        const size_t elementsCountDelta = poolContent->totalElementsCount - nrOfElementsLeftAfterRemoval;
-        poolContent->totalElementsCount = nrOfElementsLeftAfterRemoval;
-        ASSERT(poolContent->availableElementsCount >= elementsCountDelta, "Invalid available elements count!");
-        poolContent->availableElementsCount = poolContent->availableElementsCount >= elementsCountDelta
-                                                  ? poolContent->availableElementsCount - elementsCountDelta
-                                                  : 0;
-    }
+    return success;
 }
 
 static bool retrieveSliceIndex(const ListElement* element, const ListElementsPool* elementsPool, size_t* sliceIndex)
@@ -589,7 +1228,70 @@ static bool retrieveSliceIndex(const ListElement* element, const ListElementsPoo
     return isValid;
 }
 
-static ListElementsSlice* createSlice(size_t elementsCount)
+// returns 0 if the current aquiring call is not sampled
+static uint64_t startAquiringLatencySample(ListElementsPoolContent* poolContent)
+{
+    uint64_t samplingStartTime = 0;
+
+    if (poolContent != NULL && poolContent->latencySamplingPeriod > 0)
+    {
+        ++poolContent->aquiringCallsCount;
+
+        if (poolContent->aquiringCallsCount == poolContent->latencySamplingPeriod)
+        {
+            poolContent->aquiringCallsCount = 0;
+            samplingStartTime = getMonotonicTime();
+        }
+    }
+
+    return samplingStartTime;
+}
+
+static void updateAquiringStats(ListElementsPoolContent* poolContent, size_t aquiredElementsCount,
+                                size_t requiredElementsCount, uint64_t samplingStartTime)
+{
+    if (poolContent != NULL && requiredElementsCount > 0)
+    {
+        ListElementsPoolStats* stats = &poolContent->stats;
+        const size_t currentAquiredElementsCount =
+            poolContent->totalElementsCount - poolContent->availableElementsCount;
+
+        stats->aquiredElementsCount += aquiredElementsCount;
+        stats->failedAquiringsCount += aquiredElementsCount < requiredElementsCount ? 1 : 0;
+        stats->peakAquiredElementsCount = currentAquiredElementsCount > stats->peakAquiredElementsCount
+                                              ? currentAquiredElementsCount
+                                              : stats->peakAquiredElementsCount;
+
+        if (samplingStartTime > 0)
+        {
+            const uint64_t currentTime = getMonotonicTime();
+            const uint64_t latency = currentTime > samplingStartTime ? currentTime - samplingStartTime : 0;
+
+            poolContent->totalSampledAquiringLatency += latency;
+            stats->maxAquiringLatency = latency > stats->maxAquiringLatency ? latency : stats->maxAquiringLatency;
+            ++stats->sampledAquiringsCount;
+        }
+    }
+}
+
+// nanoseconds, the time origin is irrelevant as only differences are used (should never be 0)
+static uint64_t getMonotonicTime()
+{
+    struct timespec currentTime = {0, 0};
+
+#ifdef UNIX_OS
+    (void)clock_gettime(CLOCK_MONOTONIC, &currentTime);
+#else
+    (void)timespec_get(&currentTime, TIME_UTC);
+#endif
+
+    return (uint64_t)currentTime.tv_sec * 1000000000u + (uint64_t)currentTime.tv_nsec + 1;
+}
+
+/* The slice data is either allocated on the heap or provided by the mapped slices region (mappedData)
+   - the mapped data is owned by the pool so it doesn't get released on slice deletion
+*/
+static ListElementsSlice* createSlice(size_t elementsCount, void* mappedData)
 {
     ListElementsSlice* slice = NULL;
     void* data = NULL;
@@ -597,11 +1299,9 @@ static ListElementsSlice* createSlice(size_t elementsCount)
     const bool isValidElementsCount = elementsCount > 0 && elementsCount % BYTE_SIZE == 0;
     ASSERT(isValidElementsCount, "Invalid elements count for requested slice!");
 
-    if (isValidElementsCount)
+    if (isValidElementsCount && mappedData == NULL)
     {
-        const size_t dataSize =
-            SLICE_OFFSET + sizeof(ListElementsSlice) + elementsCount * sizeof(ListElement) + elementsCount / BYTE_SIZE;
-        data = malloc(dataSize);
+        data = malloc(getSliceDataSize(elementsCount));
     }
 
     if (data != NULL)
@@ -609,11 +1309,20 @@ static ListElementsSlice* createSlice(size_t elementsCount)
         // the offset bytes are required in order to prevent de-allocating data by deleting pointer to the first
         // category (slice object)
         slice = (ListElementsSlice*)(data + SLICE_OFFSET);
+        slice->data = data;
+    }
+    else if (isValidElementsCount && mappedData != NULL)
+    {
+        slice = (ListElementsSlice*)mappedData;
+        slice->data = NULL;
+    }
+
+    if (slice != NULL)
+    {
         slice->elements = (ListElement*)(slice + 1);
         slice->availabilityFlags = (byte_t*)(slice->elements + elementsCount);
         slice->totalElementsCount = elementsCount;
         slice->availableElementsCount = elementsCount;
-        slice->data = data;
 
         for (size_t index = 0; index < elementsCount; ++index)
         {
@@ -641,3 +1350,92 @@ static void deleteSlice(ListElementsSlice* slice)
 
     FREE(data);
 }
+
+// rounded up so slices placed one after another in the mapped region keep cache line alignment
+static size_t getSliceDataSize(size_t elementsCount)
+{
+    const size_t dataSize =
+        SLICE_OFFSET + sizeof(ListElementsSlice) + elementsCount * sizeof(ListElement) + elementsCount / BYTE_SIZE;
+
+    return (dataSize + SLICE_DATA_ALIGNMENT - 1) / SLICE_DATA_ALIGNMENT * SLICE_DATA_ALIGNMENT;
+}
+
+// the mapped region has a slot for each slice that can be created, a slot is free if no existing slice is placed in it
+static void* getFreeSlicesRegionSlot(const ListElementsPoolContent* poolContent)
+{
+    void* result = NULL;
+    const size_t slotsCount = poolContent != NULL && poolContent->slicesRegion != NULL && poolContent->sliceDataSize > 0
+                                  ? poolContent->slicesRegionSize / poolContent->sliceDataSize
+                                  : 0;
+
+    for (size_t slotIndex = 0; slotIndex < slotsCount && result == NULL; ++slotIndex)
+    {
+        byte_t* slot = poolContent->slicesRegion + slotIndex * poolContent->sliceDataSize;
+        bool isSlotUsed = false;
+
+        for (size_t sliceIndex = 0; sliceIndex < poolContent->slicesCount && !isSlotUsed; ++sliceIndex)
+        {
+            isSlotUsed = (byte_t*)poolContent->elementSlices[sliceIndex] == slot;
+        }
+
+        result = isSlotUsed ? NULL : slot;
+    }
+
+    return result;
+}
+
+/* Reserves the memory for all slices in one go (the region size gets rounded up to a multiple of the huge page size)
+   - explicit huge pages are tried first (these need to be configured by the system administrator)
+   - otherwise regular pages are mapped and transparent huge pages are requested for them
+   - NULL is returned if the region cannot be mapped at all (or on non-UNIX systems)
+*/
+static byte_t* mapSlicesRegion(size_t* regionSize)
+{
+    byte_t* region = NULL;
+
+#ifdef UNIX_OS
+    if (regionSize != NULL && *regionSize > 0)
+    {
+        *regionSize = (*regionSize + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        void* mappedMemory = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+        mappedMemory =
+            mmap(NULL, *regionSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+
+        if (mappedMemory == MAP_FAILED)
+        {
+            mappedMemory = mmap(NULL, *regionSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+#ifdef MADV_HUGEPAGE
+            if (mappedMemory != MAP_FAILED)
+            {
+                (void)madvise(mappedMemory, *regionSize, MADV_HUGEPAGE); // advisory only, failure is not an error
+            }
+#endif
+        }
+
+        region = mappedMemory != MAP_FAILED ? (byte_t*)mappedMemory : NULL;
+    }
+#else
+    (void)regionSize;
+#endif
+
+    return region;
+}
+
+static void unmapSlicesRegion(byte_t* region, size_t regionSize)
+{
+#ifdef UNIX_OS
+    if (region != NULL)
+    {
+        const int result = munmap(region, regionSize);
+        ASSERT(result == 0, "Unmapping the slices region failed!");
+        (void)result;
+    }
+#else
+    (void)region;
+    (void)regionSize;
+#endif
+}
@@ -1,6 +1,8 @@
 #pragma once
 
-#include "listelement.h"
+#include <stdint.h>
+
+#include "linkedlist.h"
 
 #define ELEMENTS_POOL_SLICE_SIZE 128
 
@@ -12,12 +14,59 @@
    - when the last slice got filled in, no more elements can be aquired until at least one element gets released
    - the maximum number of elements that can be aquired in the same time cannot exceed the elements count of two slices
    - unused slices can be deleted by running the shrinkPoolCapacity() function
+   - partially used slices can be emptied (and deleted) by running the compactListElementsPool() function, which
+   relocates the elements of the lists using the pool
    - deleting slices should abide to the condition that the number of available elements after deletion needs to be
    greater than 0; at least one slice (partially occupied or free) should exist
    - currently there is a fixed maximum number of slices
    - the list elements pool should not be used for lists created on the stack
 */
 
+/* The aquiring policy determines which of the available elements is handed out next
+   - LIFO (default): the most recently released element is aquired first (constant time, no search)
+   - LOCALITY: the element with the lowest address from the most populated slice (with available elements) is aquired
+   first; consecutively aquired elements are mostly adjacent in memory, which speeds up the traversal of the lists they
+   get appended to
+*/
+typedef enum
+{
+    LIFO_AQUIRING_POLICY = 0,
+    LOCALITY_AQUIRING_POLICY
+} ElementsAquiringPolicy;
+
+/* The backing determines where the slices memory comes from
+   - HEAP (default): each slice is allocated on the heap when created
+   - MAPPED: the memory for the maximum number of slices is mapped upfront, using huge pages when available (fewer TLB
+   misses); it can be pre-faulted by calling prefaultListElementsPool() so no page faults occur once the pool usage
+   increases. If the region cannot be mapped the pool falls back to heap backing.
+*/
+typedef enum
+{
+    HEAP_POOL_BACKING = 0,
+    MAPPED_POOL_BACKING
+} ElementsPoolBacking;
+
+#define POOL_OCCUPANCY_BUCKETS_COUNT 5 // empty slices + 4 occupancy quarters
+
+/* Usage stats, intended for sizing the pool (maximum slices count) based on actual load
+   - slicesOccupancy[0] counts the slices with no aquired elements, slicesOccupancy[i] (i > 0) counts the slices with an
+   occupancy within the i-th quarter, e.g. slicesOccupancy[4]: (75%, 100%]
+   - latencies are measured in nanoseconds and only available if latency sampling is enabled
+*/
+typedef struct
+{
+    size_t createdSlicesCount;
+    size_t deletedSlicesCount;
+    size_t peakAquiredElementsCount;
+    size_t failedAquiringsCount;  // aquireElement()/aquireElements() calls that could not be fulfilled
+    size_t aquiredElementsCount;  // cumulative
+    size_t releasedElementsCount; // cumulative
+    size_t slicesOccupancy[POOL_OCCUPANCY_BUCKETS_COUNT];
+    size_t sampledAquiringsCount;
+    uint64_t averageAquiringLatency;
+    uint64_t maxAquiringLatency;
+} ListElementsPoolStats;
+
 typedef struct
 {
     void* poolContent;
@@ -29,11 +78,22 @@ extern "C"
 #endif
 
     ListElementsPool* createListElementsPool(size_t maxSlicesCount);
+    ListElementsPool* createListElementsPoolWithBacking(size_t maxSlicesCount, ElementsPoolBacking backing);
     void deleteListElementsPool(ListElementsPool* elementsPool);
     ListElement* aquireElement(ListElementsPool* elementsPool);
     bool aquireElements(ListElementsPool* elementsPool, ListElement** elements, size_t requiredElementsCount);
     bool releaseElement(ListElement* element, ListElementsPool* elementsPool);
+    bool releaseElements(ListElementsPool* elementsPool, ListElement* first, ListElement* last,
+                         size_t elementsCount); // releases a chain of linked elements (first -> ... -> last)
     void shrinkPoolCapacity(ListElementsPool* elementsPool);
+    bool compactListElementsPool(ListElementsPool* elementsPool, List** lists, size_t listsCount);
+    void setElementsAquiringPolicy(ListElementsPool* elementsPool, ElementsAquiringPolicy aquiringPolicy);
+    ElementsAquiringPolicy getElementsAquiringPolicy(ListElementsPool* elementsPool);
+    bool prefaultListElementsPool(ListElementsPool* elementsPool);
+    ElementsPoolBacking getElementsPoolBacking(ListElementsPool* elementsPool);
+    bool getListElementsPoolStats(ListElementsPool* elementsPool, ListElementsPoolStats* stats);
+    void resetListElementsPoolStats(ListElementsPool* elementsPool);
+    void setAquiringLatencySamplingPeriod(ListElementsPool* elementsPool, size_t samplingPeriod);
     size_t getAvailableElementsCount(ListElementsPool* elementsPool);
     size_t getAquiredElementsCount(ListElementsPool* elementsPool);
 
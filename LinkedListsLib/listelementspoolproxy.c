@@ -4,17 +4,42 @@
 #include "listelementspool.h"
 #include "listelementspoolproxy.h"
 
+static ListElement* aquireHeapElement(void* context);
+static bool aquireHeapElements(void* context, ListElement** elements, size_t requiredElementsCount);
+static bool releaseHeapElement(void* context, ListElement* element);
+static bool releaseHeapElements(void* context, ListElement* first, ListElement* last, size_t elementsCount);
+
+static ListElement* aquirePoolElement(void* context);
+static bool aquirePoolElements(void* context, ListElement** elements, size_t requiredElementsCount);
+static bool releasePoolElement(void* context, ListElement* element);
+static bool releasePoolElements(void* context, ListElement* first, ListElement* last, size_t elementsCount);
+
+static const ListElementsAllocator heapElementsAllocator = {aquireHeapElement, aquireHeapElements,
+                                                            releaseHeapElement, releaseHeapElements};
+
+static const ListElementsAllocator poolElementsAllocator = {aquirePoolElement, aquirePoolElements,
+                                                            releasePoolElement, releasePoolElements};
+
+void initListElementsPoolProxy(ListElementsPoolProxy* elementsPoolProxy, const ListElementsAllocator* allocator,
+                               void* context)
+{
+    if (elementsPoolProxy != NULL)
+    {
+        elementsPoolProxy->allocator = allocator != NULL ? allocator : &heapElementsAllocator;
+        elementsPoolProxy->context = context;
+    }
+}
+
 ListElement* aquireListElement(ListElementsPoolProxy* elementsPoolProxy)
 {
     ListElement* element = NULL;
-    ListElementsPool* elementsPool =
-        elementsPoolProxy != NULL ? (ListElementsPool*)elementsPoolProxy->elementsPool : NULL;
 
-    ASSERT(elementsPoolProxy == NULL || elementsPool != NULL, "Invalid list elements pool proxy!");
-
-    if (elementsPool != NULL)
+    if (elementsPoolProxy != NULL)
     {
-        element = aquireElement(elementsPool);
+        const ListElementsAllocator* allocator =
+            elementsPoolProxy->allocator != NULL ? elementsPoolProxy->allocator : &heapElementsAllocator;
+
+        element = allocator->aquire(elementsPoolProxy->context);
     }
 
     return element;
@@ -23,14 +48,13 @@ ListElement* aquireListElement(ListElementsPoolProxy* elementsPoolProxy)
 bool aquireListElements(ListElementsPoolProxy* elementsPoolProxy, ListElement** elements, size_t requiredElementsCount)
 {
     bool result = false;
-    ListElementsPool* elementsPool =
-        elementsPoolProxy != NULL ? (ListElementsPool*)elementsPoolProxy->elementsPool : NULL;
-
-    ASSERT(elementsPoolProxy == NULL || elementsPool != NULL, "Invalid list elements pool proxy!");
 
-    if (elementsPool != NULL)
+    if (elementsPoolProxy != NULL)
     {
-        result = aquireElements(elementsPool, elements, requiredElementsCount);
+        const ListElementsAllocator* allocator =
+            elementsPoolProxy->allocator != NULL ? elementsPoolProxy->allocator : &heapElementsAllocator;
+
+        result = allocator->aquireBulk(elementsPoolProxy->context, elements, requiredElementsCount);
     }
 
     return result;
@@ -39,15 +63,130 @@ bool aquireListElements(ListElementsPoolProxy* elementsPoolProxy, ListElement**
 bool releaseListElement(ListElement* element, ListElementsPoolProxy* elementsPoolProxy)
 {
     bool result = false;
-    ListElementsPool* elementsPool =
-        elementsPoolProxy != NULL ? (ListElementsPool*)elementsPoolProxy->elementsPool : NULL;
 
-    ASSERT(elementsPoolProxy == NULL || elementsPool != NULL, "Invalid list elements pool proxy!");
+    if (elementsPoolProxy != NULL)
+    {
+        const ListElementsAllocator* allocator =
+            elementsPoolProxy->allocator != NULL ? elementsPoolProxy->allocator : &heapElementsAllocator;
+
+        result = allocator->release(elementsPoolProxy->context, element);
+    }
+
+    return result;
+}
+
+bool releaseListElements(ListElementsPoolProxy* elementsPoolProxy, ListElement* first, ListElement* last,
+                         size_t elementsCount)
+{
+    bool result = false;
 
-    if (elementsPool != NULL)
+    if (elementsPoolProxy != NULL)
     {
-        result = releaseElement(element, elementsPool);
+        const ListElementsAllocator* allocator =
+            elementsPoolProxy->allocator != NULL ? elementsPoolProxy->allocator : &heapElementsAllocator;
+
+        result = allocator->releaseBulk(elementsPoolProxy->context, first, last, elementsCount);
     }
 
     return result;
 }
+
+const ListElementsAllocator* getHeapElementsAllocator()
+{
+    return &heapElementsAllocator;
+}
+
+const ListElementsAllocator* getPoolElementsAllocator()
+{
+    return &poolElementsAllocator;
+}
+
+static ListElement* aquireHeapElement(void* context)
+{
+    (void)context;
+
+    return createListElement();
+}
+
+// in case of allocation failure the already allocated elements are freed
+static bool aquireHeapElements(void* context, ListElement** elements, size_t requiredElementsCount)
+{
+    bool success = elements != NULL && requiredElementsCount > 0;
+    (void)context;
+
+    for (size_t index = 0; success && index < requiredElementsCount; ++index)
+    {
+        elements[index] = createListElement();
+
+        if (elements[index] == NULL)
+        {
+            for (size_t allocatedIndex = 0; allocatedIndex < index; ++allocatedIndex)
+            {
+                FREE(elements[allocatedIndex]);
+            }
+
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+static bool releaseHeapElement(void* context, ListElement* element)
+{
+    const bool success = element != NULL;
+    (void)context;
+
+    free(element);
+
+    return success;
+}
+
+static bool releaseHeapElements(void* context, ListElement* first, ListElement* last, size_t elementsCount)
+{
+    ListElement* currentElement = first;
+    ListElement* lastFreedElement = NULL;
+    size_t freedElementsCount = 0;
+    (void)context;
+
+    while (currentElement != NULL && freedElementsCount < elementsCount)
+    {
+        ListElement* elementToFree = currentElement;
+        currentElement = currentElement->next;
+        lastFreedElement = elementToFree;
+        free(elementToFree);
+        ++freedElementsCount;
+    }
+
+    ASSERT(lastFreedElement == last, "The elements count does not match the elements chain!");
+
+    return elementsCount > 0 && freedElementsCount == elementsCount && lastFreedElement == last;
+}
+
+static ListElement* aquirePoolElement(void* context)
+{
+    ASSERT(context != NULL, "NULL elements pool!");
+
+    return aquireElement((ListElementsPool*)context);
+}
+
+static bool aquirePoolElements(void* context, ListElement** elements, size_t requiredElementsCount)
+{
+    ASSERT(context != NULL, "NULL elements pool!");
+
+    return aquireElements((ListElementsPool*)context, elements, requiredElementsCount);
+}
+
+static bool releasePoolElement(void* context, ListElement* element)
+{
+    ASSERT(context != NULL, "NULL elements pool!");
+
+    return releaseElement(element, (ListElementsPool*)context);
+}
+
+static bool releasePoolElements(void* context, ListElement* first, ListElement* last, size_t elementsCount)
+{
+    ASSERT(context != NULL, "NULL elements pool!");
+
+    return releaseElements((ListElementsPool*)context, first, last, elementsCount);
+}
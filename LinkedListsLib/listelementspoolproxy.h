@@ -9,9 +9,23 @@
    capacity
 */
 
+/* The allocator is the interface each elements source (heap, elements pool, arena etc) should implement
+    - the context is the state of the elements source (e.g. the elements pool), it is passed to each operation
+    - the bulk operations should either succeed for all elements or fail without aquiring/releasing any element
+    - it is assumed that a cleanup of the object data has been performed prior to releasing the elements
+*/
 typedef struct
 {
-    void* elementsPool;
+    ListElement* (*aquire)(void* context);
+    bool (*aquireBulk)(void* context, ListElement** elements, size_t requiredElementsCount);
+    bool (*release)(void* context, ListElement* element);
+    bool (*releaseBulk)(void* context, ListElement* first, ListElement* last, size_t elementsCount);
+} ListElementsAllocator;
+
+typedef struct
+{
+    const ListElementsAllocator* allocator; // NULL is equivalent to heap allocator
+    void* context;
 } ListElementsPoolProxy;
 
 #ifdef __cplusplus
@@ -19,10 +33,17 @@ extern "C"
 {
 #endif
 
+    void initListElementsPoolProxy(ListElementsPoolProxy* elementsPoolProxy, const ListElementsAllocator* allocator,
+                                   void* context);
     ListElement* aquireListElement(ListElementsPoolProxy* elementsPoolProxy);
     bool aquireListElements(ListElementsPoolProxy* elementsPoolProxy, ListElement** elements,
                             size_t requiredElementsCount);
     bool releaseListElement(ListElement* element, ListElementsPoolProxy* elementsPoolProxy);
+    bool releaseListElements(ListElementsPoolProxy* elementsPoolProxy, ListElement* first, ListElement* last,
+                             size_t elementsCount);
+
+    const ListElementsAllocator* getHeapElementsAllocator();
+    const ListElementsAllocator* getPoolElementsAllocator(); // context: ListElementsPool
 
 #ifdef __cplusplus
 }
@@ -14,6 +14,7 @@ ListTestFixture::ListTestFixture()
     : m_Pool{nullptr}
     , m_TempPool1{nullptr}
     , m_TempPool2{nullptr}
+    , m_TempArena{nullptr}
     , m_List1{nullptr}
     , m_List2{nullptr}
     , m_List3{nullptr}
@@ -56,6 +57,12 @@ void ListTestFixture::resetToInitialState()
 
     m_ListsMarkedForDeletion.clear();
 
+    if (m_TempArena)
+    {
+        deleteListElementsArena(m_TempArena);
+        m_TempArena = nullptr;
+    }
+
     for (auto& element : m_ListElementsMarkedForRelease)
     {
         if (element)
@@ -86,8 +93,8 @@ void ListTestFixture::resetToInitialState()
 
 bool ListTestFixture::hasInitialState() const
 {
-    return m_Pool && getAquiredElementsCount(m_Pool) == 0 && !m_TempPool1 && !m_TempPool2 && !m_List1 && !m_List2 &&
-           !m_List3 && !m_ListElementRefs && m_ListsMarkedForDeletion.empty() &&
+    return m_Pool && getAquiredElementsCount(m_Pool) == 0 && !m_TempPool1 && !m_TempPool2 && !m_TempArena &&
+           !m_List1 && !m_List2 && !m_List3 && !m_ListElementRefs && m_ListsMarkedForDeletion.empty() &&
            m_ListElementsMarkedForRelease.empty() && m_ListElementsMarkedForDeletion.empty() &&
            m_ListElementRefGroupsMarkedForDeletion.empty();
 }
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "linkedlist.h"
+#include "listelementsarena.h"
 #include "listelementspool.h"
 
 #define USE_DEFAULT_MAX_SLICES_COUNT 0
@@ -18,6 +19,9 @@ struct ListTestFixture
     ListElementsPool* m_TempPool1;
     ListElementsPool* m_TempPool2;
 
+    // temporary arena, to be cleaned up (if necessary) after each test run (after the lists using it)
+    ListElementsArena* m_TempArena;
+
     List* m_List1;
     List* m_List2;
     List* m_List3;
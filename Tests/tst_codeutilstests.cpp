@@ -1,7 +1,10 @@
 // clang-format off
 #include <QTest>
 
+#include <cstddef>
+
 #include "codeutils.h"
+#include "slaballocator.h"
 
 class CodeUtilsTests : public QObject
 {
@@ -10,6 +13,7 @@ class CodeUtilsTests : public QObject
 private slots:
     void testConvertIntToString();
     void testCopyNCharsToString();
+    void testSlabAllocator();
 };
 
 void CodeUtilsTests::testConvertIntToString()
@@ -271,6 +275,80 @@ void CodeUtilsTests::testCopyNCharsToString()
     }
 }
 
+void CodeUtilsTests::testSlabAllocator()
+{
+    SlabAllocator* slabAllocator = createSlabAllocator(sizeof(int), 4);
+
+    QVERIFY(slabAllocator != NULL);
+    QVERIFY(getSlabObjectSize(slabAllocator) >= sizeof(int));
+    QVERIFY(getSlabObjectSize(slabAllocator) % alignof(std::max_align_t) == 0);
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == 0);
+
+    int* objects[10];
+
+    for (size_t index = 0; index < 10; ++index) // more objects than fit into a slab
+    {
+        objects[index] = (int*)allocateSlabObject(slabAllocator);
+
+        QVERIFY(objects[index] != NULL);
+        QVERIFY((uintptr_t)objects[index] % alignof(std::max_align_t) == 0);
+
+        *objects[index] = (int)index;
+    }
+
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == 10);
+
+    for (size_t index = 0; index < 10; ++index)
+    {
+        QVERIFY(*objects[index] == (int)index);
+    }
+
+    // freed objects are re-used first (last freed, first re-used)
+    freeSlabObject(slabAllocator, objects[2]);
+    freeSlabObject(slabAllocator, objects[7]);
+
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == 8);
+    QVERIFY(allocateSlabObject(slabAllocator) == objects[7]);
+    QVERIFY(allocateSlabObject(slabAllocator) == objects[2]);
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == 10);
+
+    // freeing NULL has no effect
+    freeSlabObject(slabAllocator, NULL);
+
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == 10);
+
+    deleteSlabAllocator(slabAllocator);
+    slabAllocator = NULL;
+
+    // default objects count per slab
+    slabAllocator = createSlabAllocator(sizeof(double), 0);
+
+    QVERIFY(slabAllocator != NULL);
+
+    for (size_t index = 0; index < SLAB_DEFAULT_OBJECTS_COUNT + 1; ++index)
+    {
+        QVERIFY(allocateSlabObject(slabAllocator) != NULL);
+    }
+
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == SLAB_DEFAULT_OBJECTS_COUNT + 1);
+
+    deleteSlabAllocator(slabAllocator);
+    slabAllocator = NULL;
+
+    // slab size overflow: no slab can be created
+    slabAllocator = createSlabAllocator(sizeof(int), SIZE_MAX / 2);
+
+    QVERIFY(slabAllocator != NULL);
+    QVERIFY(allocateSlabObject(slabAllocator) == NULL);
+    QVERIFY(getSlabAllocatedObjectsCount(slabAllocator) == 0);
+
+    deleteSlabAllocator(slabAllocator);
+    slabAllocator = NULL;
+
+    // invalid object size
+    QVERIFY(createSlabAllocator(0, 4) == NULL);
+}
+
 QTEST_APPLESS_MAIN(CodeUtilsTests)
 
 #include "tst_codeutilstests.moc"
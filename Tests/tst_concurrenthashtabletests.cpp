@@ -0,0 +1,240 @@
+// clang-format off
+#include <QTest>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrenthashtable.h"
+
+#define DELETE_CONCURRENT_HASHTABLE(hashTable) \
+    if (hashTable) \
+    { \
+        deleteConcurrentHashTable(hashTable); \
+        hashTable = nullptr; \
+    }
+
+class ConcurrentHashTableTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ConcurrentHashTableTests();
+
+private slots:
+    void testHashTableIsCorrectlyCreated();
+    void testEntryIsCorrectlyInserted();
+    void testEntryIsCorrectlyErased();
+    void testEntryValueIsCorrectlyUpdated();
+    void testRetiredEntriesAreReclaimed();
+    void testConcurrentReadersAndWriters();
+
+    void init();
+    void cleanup();
+
+private:
+    ConcurrentHashTable* m_HashTable;
+};
+
+ConcurrentHashTableTests::ConcurrentHashTableTests()
+    : m_HashTable{nullptr}
+{
+}
+
+void ConcurrentHashTableTests::testHashTableIsCorrectlyCreated()
+{
+#ifdef UNIX_OS
+    QVERIFY(!createConcurrentHashTable(0));
+
+    m_HashTable = createConcurrentHashTable(100);
+    QVERIFY2(m_HashTable && getConcurrentHashTableEntriesCount(m_HashTable) == 0 && getConcurrentHashIndexesCount(m_HashTable) == 128, "The hash table has not been correctly created");
+#endif
+}
+
+void ConcurrentHashTableTests::testEntryIsCorrectlyInserted()
+{
+#ifdef UNIX_OS
+    m_HashTable = createConcurrentHashTable(4);
+    char value[32];
+
+    QVERIFY(insertConcurrentHashEntry("Andrei", "engineer", m_HashTable));
+    QVERIFY(insertConcurrentHashEntry("Ion", "IT manager", m_HashTable));
+    QVERIFY(insertConcurrentHashEntry("Schweinsteiger", "footballer", m_HashTable));
+    QVERIFY(insertConcurrentHashEntry("Roberto", "developer", m_HashTable));
+    QVERIFY(insertConcurrentHashEntry("Bobita", "bartender", m_HashTable));
+
+    QVERIFY(!insertConcurrentHashEntry("", "empty key", m_HashTable));
+    QVERIFY(!insertConcurrentHashEntry("Maria", "", m_HashTable));
+    QVERIFY(!insertConcurrentHashEntry(nullptr, "null key", m_HashTable));
+
+    QVERIFY2(getConcurrentHashTableEntriesCount(m_HashTable) == 5, "The total number of hash table entries is not correct");
+    QVERIFY(getConcurrentHashEntryValue("Andrei", m_HashTable, value, sizeof(value)) && strcmp(value, "engineer") == 0);
+    QVERIFY(getConcurrentHashEntryValue("Ion", m_HashTable, value, sizeof(value)) && strcmp(value, "IT manager") == 0);
+    QVERIFY(getConcurrentHashEntryValue("Schweinsteiger", m_HashTable, value, sizeof(value)) && strcmp(value, "footballer") == 0);
+    QVERIFY(getConcurrentHashEntryValue("Roberto", m_HashTable, value, sizeof(value)) && strcmp(value, "developer") == 0);
+    QVERIFY(getConcurrentHashEntryValue("Bobita", m_HashTable, value, sizeof(value)) && strcmp(value, "bartender") == 0);
+    QVERIFY(!getConcurrentHashEntryValue("Maria", m_HashTable, value, sizeof(value)));
+
+    // value truncated to the buffer size
+    QVERIFY(getConcurrentHashEntryValue("Schweinsteiger", m_HashTable, value, 5) && strcmp(value, "foot") == 0);
+#endif
+}
+
+void ConcurrentHashTableTests::testEntryIsCorrectlyErased()
+{
+#ifdef UNIX_OS
+    m_HashTable = createConcurrentHashTable(4);
+    char value[32];
+
+    insertConcurrentHashEntry("Andrei", "engineer", m_HashTable);
+    insertConcurrentHashEntry("Ion", "IT manager", m_HashTable);
+    insertConcurrentHashEntry("Ionica", "footballer", m_HashTable);
+
+    eraseConcurrentHashEntry("Ion", m_HashTable);
+
+    QVERIFY2(getConcurrentHashTableEntriesCount(m_HashTable) == 2 &&
+             !getConcurrentHashEntryValue("Ion", m_HashTable, value, sizeof(value)) &&
+             getConcurrentHashEntryValue("Andrei", m_HashTable, value, sizeof(value)) && strcmp(value, "engineer") == 0 &&
+             getConcurrentHashEntryValue("Ionica", m_HashTable, value, sizeof(value)) && strcmp(value, "footballer") == 0, "The entry has not been correctly erased");
+
+    eraseConcurrentHashEntry("Ion", m_HashTable);
+    eraseConcurrentHashEntry("Petre", m_HashTable);
+    QVERIFY(getConcurrentHashTableEntriesCount(m_HashTable) == 2 && getConcurrentHashRetiredEntriesCount(m_HashTable) == 1);
+#endif
+}
+
+void ConcurrentHashTableTests::testEntryValueIsCorrectlyUpdated()
+{
+#ifdef UNIX_OS
+    m_HashTable = createConcurrentHashTable(4);
+    char value[32];
+
+    insertConcurrentHashEntry("Roberto", "developer", m_HashTable);
+    insertConcurrentHashEntry("Andrei", "engineer", m_HashTable);
+    QVERIFY(insertConcurrentHashEntry("Roberto", "project manager", m_HashTable));
+    QVERIFY(!insertConcurrentHashEntry("Andrei", "engineer", m_HashTable)); // same value, nothing to update
+
+    QVERIFY2(getConcurrentHashTableEntriesCount(m_HashTable) == 2 && getConcurrentHashRetiredEntriesCount(m_HashTable) == 1, "The total number of hash table entries after update is not correct");
+    QVERIFY2(getConcurrentHashEntryValue("Roberto", m_HashTable, value, sizeof(value)) && strcmp(value, "project manager") == 0 &&
+             getConcurrentHashEntryValue("Andrei", m_HashTable, value, sizeof(value)) && strcmp(value, "engineer") == 0, "The entry has not been correctly updated");
+#endif
+}
+
+void ConcurrentHashTableTests::testRetiredEntriesAreReclaimed()
+{
+#ifdef UNIX_OS
+    m_HashTable = createConcurrentHashTable(16);
+
+    for (size_t index = 0; index < CONCURRENT_HASH_RECLAIM_THRESHOLD; ++index)
+    {
+        QVERIFY(insertConcurrentHashEntry(("key" + std::to_string(index)).c_str(), "value", m_HashTable));
+    }
+
+    for (size_t index = 0; index < CONCURRENT_HASH_RECLAIM_THRESHOLD - 1; ++index)
+    {
+        eraseConcurrentHashEntry(("key" + std::to_string(index)).c_str(), m_HashTable);
+    }
+
+    QVERIFY(getConcurrentHashRetiredEntriesCount(m_HashTable) == CONCURRENT_HASH_RECLAIM_THRESHOLD - 1);
+
+    // threshold reached, no reader is active so the retired entries are freed right away
+    eraseConcurrentHashEntry(("key" + std::to_string(CONCURRENT_HASH_RECLAIM_THRESHOLD - 1)).c_str(), m_HashTable);
+    QVERIFY(getConcurrentHashRetiredEntriesCount(m_HashTable) == 0 && getConcurrentHashTableEntriesCount(m_HashTable) == 0);
+#endif
+}
+
+void ConcurrentHashTableTests::testConcurrentReadersAndWriters()
+{
+#ifdef UNIX_OS
+    const size_t writersCount{4};
+    const size_t readersCount{4};
+    const size_t keysPerWriter{500};
+    const size_t updateRoundsCount{20};
+
+    m_HashTable = createConcurrentHashTable(64);
+
+    // each writer owns its keys; the value of a key is always "<key>:<round>" so readers can check its consistency
+    std::atomic<bool> writersDone{false};
+    std::atomic<size_t> inconsistentValuesCount{0};
+    std::vector<std::thread> threads;
+
+    for (size_t writerIndex = 0; writerIndex < writersCount; ++writerIndex)
+    {
+        threads.emplace_back([this, writerIndex, keysPerWriter, updateRoundsCount]() {
+            for (size_t round = 0; round < updateRoundsCount; ++round)
+            {
+                for (size_t index = 0; index < keysPerWriter; ++index)
+                {
+                    const std::string key{"w" + std::to_string(writerIndex) + "_" + std::to_string(index)};
+
+                    // odd keys are erased and inserted back in each round
+                    if (index % 2 == 1 && round > 0)
+                    {
+                        eraseConcurrentHashEntry(key.c_str(), m_HashTable);
+                    }
+
+                    insertConcurrentHashEntry(key.c_str(), (key + ":" + std::to_string(round)).c_str(), m_HashTable);
+                }
+            }
+        });
+    }
+
+    for (size_t readerIndex = 0; readerIndex < readersCount; ++readerIndex)
+    {
+        threads.emplace_back([this, &writersDone, &inconsistentValuesCount, writersCount, keysPerWriter]() {
+            char value[64];
+
+            while (!writersDone.load())
+            {
+                for (size_t index = 0; index < writersCount * keysPerWriter; ++index)
+                {
+                    const std::string key{"w" + std::to_string(index % writersCount) + "_" + std::to_string(index / writersCount)};
+
+                    if (getConcurrentHashEntryValue(key.c_str(), m_HashTable, value, sizeof(value)) && strncmp(value, (key + ":").c_str(), key.size() + 1) != 0)
+                    {
+                        ++inconsistentValuesCount;
+                    }
+                }
+            }
+        });
+    }
+
+    for (size_t writerIndex = 0; writerIndex < writersCount; ++writerIndex)
+    {
+        threads[writerIndex].join();
+    }
+
+    writersDone.store(true);
+
+    for (size_t readerIndex = 0; readerIndex < readersCount; ++readerIndex)
+    {
+        threads[writersCount + readerIndex].join();
+    }
+
+    QVERIFY2(inconsistentValuesCount.load() == 0, "Inconsistent values have been read");
+    QVERIFY(getConcurrentHashTableEntriesCount(m_HashTable) == writersCount * keysPerWriter);
+
+    char value[64];
+    const std::string expectedValue{"w3_7:" + std::to_string(updateRoundsCount - 1)};
+    QVERIFY(getConcurrentHashEntryValue("w3_7", m_HashTable, value, sizeof(value)) && expectedValue == value);
+#endif
+}
+
+void ConcurrentHashTableTests::init()
+{
+    QVERIFY(!m_HashTable);
+}
+
+void ConcurrentHashTableTests::cleanup()
+{
+#ifdef UNIX_OS
+    DELETE_CONCURRENT_HASHTABLE(m_HashTable);
+#endif
+}
+
+QTEST_APPLESS_MAIN(ConcurrentHashTableTests)
+
+#include "tst_concurrenthashtabletests.moc"
+// clang-format on
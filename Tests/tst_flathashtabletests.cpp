@@ -0,0 +1,186 @@
+// clang-format off
+#include <QTest>
+
+#include <cstring>
+#include <string>
+
+#include "flathashtable.h"
+
+#define DELETE_FLAT_HASHTABLE(hashTable) \
+    if (hashTable) \
+    { \
+        deleteFlatHashTable(hashTable); \
+        hashTable = nullptr; \
+    }
+
+class FlatHashTableTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FlatHashTableTests();
+
+private slots:
+    void testHashTableIsCorrectlyCreated();
+    void testEntryIsCorrectlyInserted();
+    void testEntryIsCorrectlyErased();
+    void testEntryValueIsCorrectlyUpdated();
+    void testHashTableGrows();
+    void testDeletedSlotsAreReused();
+
+    void init();
+    void cleanup();
+
+private:
+    FlatHashTable* m_HashTable1;
+    FlatHashTable* m_HashTable2;
+};
+
+FlatHashTableTests::FlatHashTableTests()
+    : m_HashTable1{nullptr}
+    , m_HashTable2{nullptr}
+{
+}
+
+void FlatHashTableTests::testHashTableIsCorrectlyCreated()
+{
+    m_HashTable1 = createFlatHashTable(5);
+    QVERIFY2(getFlatHashTableEntriesCount(m_HashTable1) == 0 && getFlatHashTableCapacity(m_HashTable1) == FLAT_HASH_GROUP_SIZE, "The hash table has not been correctly created");
+
+    m_HashTable2 = createFlatHashTable(100);
+    QVERIFY2(getFlatHashTableEntriesCount(m_HashTable2) == 0 && getFlatHashTableCapacity(m_HashTable2) == 128, "The hash table has not been correctly created");
+}
+
+void FlatHashTableTests::testEntryIsCorrectlyInserted()
+{
+    m_HashTable1 = createFlatHashTable(0);
+
+    QVERIFY(insertFlatHashEntry("Andrei", "engineer", m_HashTable1));
+    QVERIFY(insertFlatHashEntry("Ion", "IT manager", m_HashTable1));
+    QVERIFY(insertFlatHashEntry("Schweinsteiger", "footballer", m_HashTable1));
+    QVERIFY(insertFlatHashEntry("Roberto", "developer", m_HashTable1));
+    QVERIFY(insertFlatHashEntry("Bobita", "bartender", m_HashTable1));
+
+    QVERIFY(!insertFlatHashEntry("", "empty key", m_HashTable1));
+    QVERIFY(!insertFlatHashEntry("Maria", "", m_HashTable1));
+    QVERIFY(!insertFlatHashEntry(nullptr, "null key", m_HashTable1));
+
+    QVERIFY2(getFlatHashTableEntriesCount(m_HashTable1) == 5, "The total number of hash table entries is not correct");
+    QVERIFY2(strcmp(getFlatHashEntryValue("Andrei", m_HashTable1), "engineer") == 0 &&
+             strcmp(getFlatHashEntryValue("Ion", m_HashTable1), "IT manager") == 0 &&
+             strcmp(getFlatHashEntryValue("Schweinsteiger", m_HashTable1), "footballer") == 0 &&
+             strcmp(getFlatHashEntryValue("Roberto", m_HashTable1), "developer") == 0 &&
+             strcmp(getFlatHashEntryValue("Bobita", m_HashTable1), "bartender") == 0,   "The entries have not been correctly inserted");
+    QVERIFY(!getFlatHashEntryValue("Maria", m_HashTable1));
+}
+
+void FlatHashTableTests::testEntryIsCorrectlyErased()
+{
+    m_HashTable1 = createFlatHashTable(0);
+
+    insertFlatHashEntry("Andrei", "engineer", m_HashTable1);
+    insertFlatHashEntry("Ion", "IT manager", m_HashTable1);
+    insertFlatHashEntry("Ionica", "footballer", m_HashTable1);
+
+    eraseFlatHashEntry("Ion", m_HashTable1);
+
+    QVERIFY2(getFlatHashTableEntriesCount(m_HashTable1) == 2 &&
+             !getFlatHashEntryValue("Ion", m_HashTable1) &&
+             strcmp(getFlatHashEntryValue("Andrei", m_HashTable1), "engineer") == 0 &&
+             strcmp(getFlatHashEntryValue("Ionica", m_HashTable1), "footballer") == 0 , "The entry has not been correctly erased");
+
+    eraseFlatHashEntry("Ion", m_HashTable1);
+    QVERIFY(getFlatHashTableEntriesCount(m_HashTable1) == 2);
+
+    eraseFlatHashEntry("Petre", m_HashTable1);
+    QVERIFY(getFlatHashTableEntriesCount(m_HashTable1) == 2);
+
+    QVERIFY(insertFlatHashEntry("Ion", "IT manager", m_HashTable1));
+    QVERIFY(getFlatHashTableEntriesCount(m_HashTable1) == 3 && strcmp(getFlatHashEntryValue("Ion", m_HashTable1), "IT manager") == 0);
+}
+
+void FlatHashTableTests::testEntryValueIsCorrectlyUpdated()
+{
+    m_HashTable1 = createFlatHashTable(0);
+
+    insertFlatHashEntry("Roberto", "developer", m_HashTable1);
+    insertFlatHashEntry("Andrei", "engineer", m_HashTable1);
+    QVERIFY(insertFlatHashEntry("Roberto", "project manager", m_HashTable1));
+    QVERIFY(!insertFlatHashEntry("Andrei", "engineer", m_HashTable1)); // same value, nothing to update
+
+    QVERIFY2(getFlatHashTableEntriesCount(m_HashTable1) == 2, "The total number of hash table entries after updated is not correct");
+    QVERIFY2(strcmp(getFlatHashEntryValue("Roberto", m_HashTable1), "project manager") == 0 &&
+             strcmp(getFlatHashEntryValue("Andrei", m_HashTable1), "engineer") == 0,            "The entry has not been correctly updated");
+}
+
+void FlatHashTableTests::testHashTableGrows()
+{
+    m_HashTable1 = createFlatHashTable(0);
+
+    // max 14 entries out of 16 slots
+    for (size_t index = 0; index < 14; ++index)
+    {
+        QVERIFY(insertFlatHashEntry(("key" + std::to_string(index)).c_str(), std::to_string(index).c_str(), m_HashTable1));
+    }
+
+    QVERIFY(getFlatHashTableCapacity(m_HashTable1) == 16);
+
+    for (size_t index = 14; index < 1000; ++index)
+    {
+        QVERIFY(insertFlatHashEntry(("key" + std::to_string(index)).c_str(), std::to_string(index).c_str(), m_HashTable1));
+    }
+
+    QVERIFY(getFlatHashTableEntriesCount(m_HashTable1) == 1000 && getFlatHashTableCapacity(m_HashTable1) == 2048);
+
+    for (size_t index = 0; index < 1000; ++index)
+    {
+        const char* value = getFlatHashEntryValue(("key" + std::to_string(index)).c_str(), m_HashTable1);
+        QVERIFY(value && std::to_string(index) == value);
+    }
+
+    QVERIFY(!getFlatHashEntryValue("key1000", m_HashTable1));
+}
+
+void FlatHashTableTests::testDeletedSlotsAreReused()
+{
+    m_HashTable1 = createFlatHashTable(0);
+
+    // high churn with few entries: deleted slots should not make the table grow
+    for (size_t index = 0; index < 1000; ++index)
+    {
+        const std::string key{"key" + std::to_string(index)};
+
+        QVERIFY(insertFlatHashEntry(key.c_str(), "value", m_HashTable1));
+
+        if (index >= 4)
+        {
+            eraseFlatHashEntry(("key" + std::to_string(index - 4)).c_str(), m_HashTable1);
+        }
+
+        QVERIFY(getFlatHashEntryValue(key.c_str(), m_HashTable1));
+    }
+
+    QVERIFY(getFlatHashTableEntriesCount(m_HashTable1) == 4 && getFlatHashTableCapacity(m_HashTable1) == 16);
+
+    for (size_t index = 996; index < 1000; ++index)
+    {
+        QVERIFY(getFlatHashEntryValue(("key" + std::to_string(index)).c_str(), m_HashTable1));
+    }
+}
+
+void FlatHashTableTests::init()
+{
+    QVERIFY(!m_HashTable1);
+    QVERIFY(!m_HashTable2);
+}
+
+void FlatHashTableTests::cleanup()
+{
+    DELETE_FLAT_HASHTABLE(m_HashTable1);
+    DELETE_FLAT_HASHTABLE(m_HashTable2);
+}
+
+QTEST_APPLESS_MAIN(FlatHashTableTests)
+
+#include "tst_flathashtabletests.moc"
+// clang-format on
@@ -2,6 +2,8 @@
 #include <QTest>
 
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "listtestfixture.h"
 #include "hashtable.h"
@@ -26,6 +28,11 @@ private slots:
     void testEntryIsCorrectlyInserted();
     void testEntryIsCorrectlyErased();
     void testEntryValueIsCorrectlyUpdated();
+    void testEntryStorageIsCorrectlyResized();
+    void testHashTableIsAutomaticallyResized();
+    void testHashTableIsIncrementallyRehashed();
+    void testMultipleEntryValuesAreRetrieved();
+    void testEntriesWithLengthDelimitedKeys();
 
     void initTestCase_data();
     void cleanupTestCase();
@@ -50,7 +57,7 @@ void HashTableTests::testHashTableIsCorrectlyCreated()
     QVERIFY(!pool || pool == m_Fixture.m_Pool);
 
     m_HashTable1 = createHashTable(5, pool);
-    QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 0 && getHashIndexesCount(m_HashTable1) == 5, "The hash table has not been correctly created");
+    QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 0 && getHashIndexesCount(m_HashTable1) == 8, "The hash table has not been correctly created");
 }
 
 void HashTableTests::testHashIndexesAreCorrectlyRetrieved()
@@ -61,38 +68,43 @@ void HashTableTests::testHashIndexesAreCorrectlyRetrieved()
     QVERIFY2(getHashIndexForKey("Bobita", 1) == 0, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Maria", 1) == 0, "Hash index is not correctly retrieved");
 
-    QVERIFY2(getHashIndexForKey("Liviu", 2) == 1, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Andrei", 2) == 1, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Liviu", 2) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Andrei", 2) == 0, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Ronaldinho", 2) == 0, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Ion", 2) == 0, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Werner", 2) == 1, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Werner", 2) == 0, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Andreea", 2) == 0, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Schweinsteiger", 2) == 0, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Roberto", 2) == 1, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Bobita", 2) == 1, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Maria", 2) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Roberto", 2) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Bobita", 2) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Maria", 2) == 1, "Hash index is not correctly retrieved");
 
-    QVERIFY2(getHashIndexForKey("Liviu", 7) == 3, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Andrei", 7) == 0, "Hash index is not correctly retrieved");
+    // hash size rounded up to the next power of two (7 -> 8)
+    QVERIFY2(getHashIndexForKey("Liviu", 7) == 2, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Andrei", 7) == 2, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Ronaldinho", 7) == 2, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Ion", 7) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Ion", 7) == 2, "Hash index is not correctly retrieved");
     QVERIFY2(getHashIndexForKey("Werner", 7) == 4, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Andreea", 7) == 2, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Schweinsteiger", 2) == 0, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Roberto", 7) == 5, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Bobita", 7) == 5, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Maria", 7) == 0, "Hash index is not correctly retrieved");
-
-    QVERIFY2(getHashIndexForKey("Liviu", 11) == 4, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Andrei", 11) == 1, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Ronaldinho", 11) == 4, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Ion", 11) == 8, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Werner", 11) == 0, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Andreea", 11) == 6, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Schweinsteiger", 11) == 2, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Roberto", 11) == 7, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Bobita", 11) == 10, "Hash index is not correctly retrieved");
-    QVERIFY2(getHashIndexForKey("Maria", 11) == 6, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Andreea", 7) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Schweinsteiger", 7) == 4, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Roberto", 7) == 4, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Bobita", 7) == 6, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Maria", 7) == 3, "Hash index is not correctly retrieved");
+
+    QVERIFY2(getHashIndexForKey("Liviu", 16) == 2, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Andrei", 16) == 2, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Ronaldinho", 16) == 2, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Ion", 16) == 10, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Werner", 16) == 12, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Andreea", 16) == 0, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Schweinsteiger", 16) == 12, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Roberto", 16) == 4, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Bobita", 16) == 6, "Hash index is not correctly retrieved");
+    QVERIFY2(getHashIndexForKey("Maria", 16) == 3, "Hash index is not correctly retrieved");
+
+    // keys consisting of the same characters no longer collide
+    QVERIFY2(getHashIndexForKey("uviLi", 16) == 12 && getHashIndexForKey("viuLi", 16) == 4, "Hash index is not correctly retrieved");
+    QVERIFY(getHashIndexForKey("Liviu", 7) == getHashIndexForKey("Liviu", 8));
 }
 
 void HashTableTests::testEntryIsCorrectlyInserted()
@@ -109,7 +121,7 @@ void HashTableTests::testEntryIsCorrectlyInserted()
     insertHashEntry("Bobita", "bartender", m_HashTable1);
 
     QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 5, "The total number of hash table entries is not correct");
-    QVERIFY2(getHashIndexesCount(m_HashTable1) == 7, "The total number of hash table entries is not correct");
+    QVERIFY2(getHashIndexesCount(m_HashTable1) == 8, "The total number of hash table entries is not correct");
     QVERIFY2(strcmp(getHashEntryValue("Andrei", m_HashTable1), "engineer") == 0 &&
              strcmp(getHashEntryValue("Ion", m_HashTable1), "IT manager") == 0 &&
              strcmp(getHashEntryValue("Schweinsteiger", m_HashTable1), "footballer") == 0 &&
@@ -132,7 +144,7 @@ void HashTableTests::testEntryIsCorrectlyErased()
         eraseHashEntry("Ion", m_HashTable1);
 
         QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 2 &&
-                 getHashIndexesCount(m_HashTable1) == 5 &&
+                 getHashIndexesCount(m_HashTable1) == 8 &&
                  strcmp(getHashEntryValue("Andrei", m_HashTable1), "engineer") == 0 &&
                  strcmp(getHashEntryValue("Ionica", m_HashTable1), "footballer") == 0 , "The entry has not been correctly erased");
 
@@ -147,7 +159,7 @@ void HashTableTests::testEntryIsCorrectlyErased()
         m_HashTable2 = createHashTable(5, pool);
         eraseHashEntry("Petre", m_HashTable2);
 
-        QVERIFY(getHashTableEntriesCount(m_HashTable2) == 0 && getHashIndexesCount(m_HashTable2) == 5);
+        QVERIFY(getHashTableEntriesCount(m_HashTable2) == 0 && getHashIndexesCount(m_HashTable2) == 8);
     }
 }
 
@@ -163,11 +175,236 @@ void HashTableTests::testEntryValueIsCorrectlyUpdated()
     insertHashEntry("Roberto", "project manager", m_HashTable1);
 
     QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 2, "The total number of hash table entries after updated is not correct");
-    QVERIFY2(getHashIndexesCount(m_HashTable1) == 7, "The total number of hash table entries after update is not correct");
+    QVERIFY2(getHashIndexesCount(m_HashTable1) == 8, "The total number of hash table entries after update is not correct");
     QVERIFY2(strcmp(getHashEntryValue("Roberto", m_HashTable1), "project manager") == 0 &&
              strcmp(getHashEntryValue("Andrei", m_HashTable1), "engineer") == 0,            "The entry has not been correctly updated");
 }
 
+void HashTableTests::testEntryStorageIsCorrectlyResized()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    const std::string longKey(HASH_ENTRY_INLINE_STORAGE_SIZE, 'k');
+    const std::string longValue(2 * HASH_ENTRY_INLINE_STORAGE_SIZE, 'v');
+
+    m_HashTable1 = createHashTable(4, pool);
+
+    // short entry: value updated in place, then moved to a larger entry, then written in place again
+    QVERIFY(insertHashEntry("Roberto", "developer", m_HashTable1));
+    QVERIFY(insertHashEntry("Roberto", "dev", m_HashTable1));
+    QVERIFY(strcmp(getHashEntryValue("Roberto", m_HashTable1), "dev") == 0);
+    QVERIFY(insertHashEntry("Roberto", longValue.c_str(), m_HashTable1));
+    QVERIFY(getHashEntryValue("Roberto", m_HashTable1) == longValue);
+    QVERIFY(insertHashEntry("Roberto", "project manager", m_HashTable1));
+    QVERIFY(strcmp(getHashEntryValue("Roberto", m_HashTable1), "project manager") == 0);
+
+    // key not fitting into the inline storage
+    QVERIFY(insertHashEntry(longKey.c_str(), "value", m_HashTable1));
+    QVERIFY(insertHashEntry(longKey.c_str(), longValue.c_str(), m_HashTable1));
+    QVERIFY(getHashEntryValue(longKey.c_str(), m_HashTable1) == longValue);
+    QVERIFY(!getHashEntryValue(longKey.substr(1).c_str(), m_HashTable1));
+
+    QVERIFY(getHashTableEntriesCount(m_HashTable1) == 2);
+
+    eraseHashEntry(longKey.c_str(), m_HashTable1);
+    QVERIFY(getHashTableEntriesCount(m_HashTable1) == 1 && !getHashEntryValue(longKey.c_str(), m_HashTable1));
+
+    // long entries remaining in the table are released when deleting it
+    QVERIFY(insertHashEntry(longKey.c_str(), longValue.c_str(), m_HashTable1));
+}
+
+void HashTableTests::testHashTableIsAutomaticallyResized()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    const std::vector<std::string> keys{"Liviu", "Andrei", "Ronaldinho", "Ion", "Werner", "Andreea", "Schweinsteiger", "Roberto", "Bobita", "Maria"};
+
+    m_HashTable1 = createHashTable(2, pool);
+    QVERIFY(m_HashTable1);
+
+    for (const auto& key : keys)
+    {
+        QVERIFY(insertHashEntry(key.c_str(), (key + " value").c_str(), m_HashTable1));
+    }
+
+    // default max load factor 1: 2 -> 4 -> 8 -> 16
+    QVERIFY(getHashTableEntriesCount(m_HashTable1) == 10 && getHashIndexesCount(m_HashTable1) == 16);
+
+    // the list elements are re-linked, not re-allocated
+    QVERIFY(!pool || getAquiredElementsCount(pool) == 10);
+
+    for (const auto& key : keys)
+    {
+        const char* value = getHashEntryValue(key.c_str(), m_HashTable1);
+        QVERIFY(value && key + " value" == value);
+    }
+
+    // no shrinking by default
+    for (size_t index = 0; index < 8; ++index)
+    {
+        eraseHashEntry(keys[index].c_str(), m_HashTable1);
+    }
+
+    QVERIFY(getHashTableEntriesCount(m_HashTable1) == 2 && getHashIndexesCount(m_HashTable1) == 16);
+
+    // shrink while the load factor is below a quarter of the max load factor: 16 -> 8 -> 4
+    QVERIFY(setHashTableMaxLoadFactor(m_HashTable1, 2.0, true));
+    QVERIFY(getHashTableEntriesCount(m_HashTable1) == 2 && getHashIndexesCount(m_HashTable1) == 4);
+    QVERIFY(strcmp(getHashEntryValue("Bobita", m_HashTable1), "Bobita value") == 0 && strcmp(getHashEntryValue("Maria", m_HashTable1), "Maria value") == 0);
+
+    QVERIFY(!setHashTableMaxLoadFactor(m_HashTable1, -1.0, true));
+
+    // reserved size is kept when erasing entries
+    QVERIFY(reserveHashTable(m_HashTable1, 100));
+    QVERIFY(getHashIndexesCount(m_HashTable1) == 64);
+
+    eraseHashEntry("Bobita", m_HashTable1);
+    eraseHashEntry("Maria", m_HashTable1);
+    QVERIFY(getHashTableEntriesCount(m_HashTable1) == 0 && getHashIndexesCount(m_HashTable1) == 64);
+
+    // automatic resizing disabled
+    m_HashTable2 = createHashTable(1, pool);
+    QVERIFY(setHashTableMaxLoadFactor(m_HashTable2, 0.0, true));
+
+    for (const auto& key : keys)
+    {
+        QVERIFY(insertHashEntry(key.c_str(), "value", m_HashTable2));
+    }
+
+    QVERIFY(getHashTableEntriesCount(m_HashTable2) == 10 && getHashIndexesCount(m_HashTable2) == 1);
+}
+
+void HashTableTests::testHashTableIsIncrementallyRehashed()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    m_HashTable1 = createHashTable(16, pool);
+    QVERIFY(m_HashTable1);
+
+    std::vector<std::string> keys;
+
+    for (size_t index = 0; index < 16; ++index)
+    {
+        keys.push_back("key" + std::to_string(index));
+        QVERIFY(insertHashEntry(keys.back().c_str(), "value", m_HashTable1));
+    }
+
+    QVERIFY(!isHashTableRehashing(m_HashTable1) && getHashIndexesCount(m_HashTable1) == 16);
+
+    // max load factor exceeded: the new buckets are created, the old ones get rehashed by the next calls (4 buckets per call)
+    keys.push_back("key16");
+    QVERIFY(insertHashEntry(keys.back().c_str(), "value", m_HashTable1));
+    QVERIFY(isHashTableRehashing(m_HashTable1) && getHashIndexesCount(m_HashTable1) == 32 && getHashTableEntriesCount(m_HashTable1) == 17);
+
+    QVERIFY(getHashEntryValue("key0", m_HashTable1) && isHashTableRehashing(m_HashTable1));
+    QVERIFY(insertHashEntry("key17", "value", m_HashTable1) && isHashTableRehashing(m_HashTable1));
+    eraseHashEntry("key3", m_HashTable1);
+    QVERIFY(isHashTableRehashing(m_HashTable1) && getHashTableEntriesCount(m_HashTable1) == 17);
+
+    // last old buckets rehashed
+    QVERIFY(getHashEntryValue("key17", m_HashTable1) && !isHashTableRehashing(m_HashTable1));
+
+    for (const auto& key : keys)
+    {
+        QVERIFY((getHashEntryValue(key.c_str(), m_HashTable1) != nullptr) == (key != "key3"));
+    }
+
+    QVERIFY(!pool || getAquiredElementsCount(pool) == 17);
+
+    // deleting the table while rehashing
+    m_HashTable2 = createHashTable(1, pool);
+    QVERIFY(insertHashEntry("Liviu", "engineer", m_HashTable2) && insertHashEntry("Andrei", "manager", m_HashTable2));
+    QVERIFY(isHashTableRehashing(m_HashTable2) && getHashIndexesCount(m_HashTable2) == 2);
+}
+
+void HashTableTests::testMultipleEntryValuesAreRetrieved()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    m_HashTable1 = createHashTable(16, pool);
+    QVERIFY(m_HashTable1);
+
+    // more keys than the batch size, some of them missing or invalid
+    std::vector<std::string> keyStrings;
+    std::vector<const char*> keys;
+
+    for (size_t index = 0; index < 48; ++index)
+    {
+        keyStrings.push_back("key" + std::to_string(index));
+
+        if (index % 3 != 0)
+        {
+            QVERIFY(insertHashEntry(keyStrings.back().c_str(), ("value" + std::to_string(index)).c_str(), m_HashTable1));
+        }
+    }
+
+    for (const auto& key : keyStrings)
+    {
+        keys.push_back(key.c_str());
+    }
+
+    keys.push_back("");
+    keys.push_back(nullptr);
+
+    std::vector<const char*> values(keys.size(), "dummy");
+
+    QVERIFY(getHashEntryValues(keys.data(), keys.size(), values.data(), m_HashTable1) == 32);
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        const bool isFound{index < keyStrings.size() && index % 3 != 0};
+
+        QVERIFY(isFound ? values[index] && ("value" + std::to_string(index)) == values[index] : !values[index]);
+    }
+
+    // lookups performed while rehashing (max load factor exceeded)
+    QVERIFY(insertHashEntry("key0", "value0", m_HashTable1) && isHashTableRehashing(m_HashTable1));
+    QVERIFY(getHashEntryValues(keys.data(), keyStrings.size(), values.data(), m_HashTable1) == 33 && values[0] && strcmp(values[0], "value0") == 0);
+
+    QVERIFY(getHashEntryValues(keys.data(), 0, values.data(), m_HashTable1) == 0);
+    QVERIFY(getHashEntryValues(nullptr, keys.size(), values.data(), m_HashTable1) == 0);
+}
+
+void HashTableTests::testEntriesWithLengthDelimitedKeys()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    m_HashTable1 = createHashTable(16, pool);
+    QVERIFY(m_HashTable1);
+
+    // keys located inside a (non-terminated) buffer, as received from the network
+    const char buffer[] = {'A', 'n', 'd', 'r', 'e', 'i', 'I', 'o', 'n', 'I', 'o', 'n', 'i', 'c', 'a'};
+
+    QVERIFY(insertHashEntryN(buffer, 6, "engineer", m_HashTable1));
+    QVERIFY(insertHashEntryN(buffer + 6, 3, "IT manager", m_HashTable1));
+    QVERIFY(insertHashEntryN(buffer + 9, 6, "footballer", m_HashTable1));
+    QVERIFY(!insertHashEntryN(buffer, 0, "empty key", m_HashTable1));
+    QVERIFY(!insertHashEntryN(nullptr, 4, "null key", m_HashTable1));
+    QVERIFY(!insertHashEntryN(buffer + 6, 3, "IT manager", m_HashTable1)); // same value, nothing to update
+
+    // the length delimited and the terminated keys are interchangeable
+    QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 3 &&
+             strcmp(getHashEntryValue("Andrei", m_HashTable1), "engineer") == 0 &&
+             strcmp(getHashEntryValue("Ion", m_HashTable1), "IT manager") == 0 &&
+             strcmp(getHashEntryValueN(buffer + 9, 6, m_HashTable1), "footballer") == 0 &&
+             strcmp(getHashEntryValueN("Ion", 3, m_HashTable1), "IT manager") == 0, "The entries have not been correctly inserted");
+
+    QVERIFY(!getHashEntryValueN(buffer, 3, m_HashTable1) && !getHashEntryValueN(buffer + 6, 6, m_HashTable1));
+
+    QVERIFY(insertHashEntry("Ion", "developer", m_HashTable1));
+    QVERIFY(strcmp(getHashEntryValueN(buffer + 6, 3, m_HashTable1), "developer") == 0);
+
+    eraseHashEntryN(buffer, 6, m_HashTable1);
+    eraseHashEntryN(buffer + 9, 3, m_HashTable1); // "Ion", read from the "Ionica" chars
+    QVERIFY2(getHashTableEntriesCount(m_HashTable1) == 1 && !getHashEntryValue("Andrei", m_HashTable1) &&
+             !getHashEntryValue("Ion", m_HashTable1) && strcmp(getHashEntryValue("Ionica", m_HashTable1), "footballer") == 0, "The entries have not been correctly erased");
+}
+
 void HashTableTests::initTestCase_data()
 {
     m_Fixture.init();
@@ -0,0 +1,182 @@
+// clang-format off
+#include <QTest>
+
+#include <vector>
+
+#include "inthashmap.h"
+
+#define DELETE_INT_HASHMAP(hashMap) \
+    if (hashMap) \
+    { \
+        deleteIntHashMap(hashMap); \
+        hashMap = nullptr; \
+    }
+
+class IntHashMapTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit IntHashMapTests();
+
+private slots:
+    void testHashMapIsCorrectlyCreated();
+    void testEntryIsCorrectlyInserted();
+    void testEntryIsCorrectlyErased();
+    void testEntryValueIsCorrectlyUpdated();
+    void testHashMapGrows();
+    void testEntriesAreShiftedBackOnErase();
+
+    void init();
+    void cleanup();
+
+private:
+    IntHashMap* m_HashMap1;
+    IntHashMap* m_HashMap2;
+    std::vector<int> m_Values;
+};
+
+IntHashMapTests::IntHashMapTests()
+    : m_HashMap1{nullptr}
+    , m_HashMap2{nullptr}
+    , m_Values(2000)
+{
+}
+
+void IntHashMapTests::testHashMapIsCorrectlyCreated()
+{
+    m_HashMap1 = createIntHashMap(5);
+    QVERIFY2(getIntHashMapEntriesCount(m_HashMap1) == 0 && getIntHashMapCapacity(m_HashMap1) == INT_HASH_MAP_MIN_CAPACITY, "The hash map has not been correctly created");
+
+    m_HashMap2 = createIntHashMap(100);
+    QVERIFY2(getIntHashMapEntriesCount(m_HashMap2) == 0 && getIntHashMapCapacity(m_HashMap2) == 128, "The hash map has not been correctly created");
+}
+
+void IntHashMapTests::testEntryIsCorrectlyInserted()
+{
+    m_HashMap1 = createIntHashMap(0);
+
+    QVERIFY(insertIntHashEntry(0, &m_Values[0], m_HashMap1));
+    QVERIFY(insertIntHashEntry(17, &m_Values[1], m_HashMap1));
+    QVERIFY(insertIntHashEntry(1024, &m_Values[2], m_HashMap1));
+    QVERIFY(insertIntHashEntry(SIZE_MAX, &m_Values[3], m_HashMap1));
+    QVERIFY(!insertIntHashEntry(5, nullptr, m_HashMap1));
+
+    QVERIFY2(getIntHashMapEntriesCount(m_HashMap1) == 4, "The total number of hash map entries is not correct");
+    QVERIFY2(getIntHashEntryValue(0, m_HashMap1) == &m_Values[0] &&
+             getIntHashEntryValue(17, m_HashMap1) == &m_Values[1] &&
+             getIntHashEntryValue(1024, m_HashMap1) == &m_Values[2] &&
+             getIntHashEntryValue(SIZE_MAX, m_HashMap1) == &m_Values[3], "The entries have not been correctly inserted");
+    QVERIFY(!getIntHashEntryValue(5, m_HashMap1));
+}
+
+void IntHashMapTests::testEntryIsCorrectlyErased()
+{
+    m_HashMap1 = createIntHashMap(0);
+
+    insertIntHashEntry(10, &m_Values[0], m_HashMap1);
+    insertIntHashEntry(20, &m_Values[1], m_HashMap1);
+    insertIntHashEntry(30, &m_Values[2], m_HashMap1);
+
+    eraseIntHashEntry(20, m_HashMap1);
+
+    QVERIFY2(getIntHashMapEntriesCount(m_HashMap1) == 2 &&
+             !getIntHashEntryValue(20, m_HashMap1) &&
+             getIntHashEntryValue(10, m_HashMap1) == &m_Values[0] &&
+             getIntHashEntryValue(30, m_HashMap1) == &m_Values[2], "The entry has not been correctly erased");
+
+    eraseIntHashEntry(20, m_HashMap1);
+    eraseIntHashEntry(40, m_HashMap1);
+    QVERIFY(getIntHashMapEntriesCount(m_HashMap1) == 2);
+
+    QVERIFY(insertIntHashEntry(20, &m_Values[1], m_HashMap1));
+    QVERIFY(getIntHashMapEntriesCount(m_HashMap1) == 3 && getIntHashEntryValue(20, m_HashMap1) == &m_Values[1]);
+}
+
+void IntHashMapTests::testEntryValueIsCorrectlyUpdated()
+{
+    m_HashMap1 = createIntHashMap(0);
+
+    insertIntHashEntry(7, &m_Values[0], m_HashMap1);
+    insertIntHashEntry(8, &m_Values[1], m_HashMap1);
+    QVERIFY(insertIntHashEntry(7, &m_Values[2], m_HashMap1));
+    QVERIFY(!insertIntHashEntry(8, &m_Values[1], m_HashMap1)); // same value, nothing to update
+
+    QVERIFY2(getIntHashMapEntriesCount(m_HashMap1) == 2, "The total number of hash map entries after update is not correct");
+    QVERIFY2(getIntHashEntryValue(7, m_HashMap1) == &m_Values[2] && getIntHashEntryValue(8, m_HashMap1) == &m_Values[1], "The entry has not been correctly updated");
+}
+
+void IntHashMapTests::testHashMapGrows()
+{
+    m_HashMap1 = createIntHashMap(0);
+
+    // max 6 entries out of 8 slots
+    for (size_t key = 0; key < 6; ++key)
+    {
+        QVERIFY(insertIntHashEntry(key, &m_Values[key], m_HashMap1));
+    }
+
+    QVERIFY(getIntHashMapCapacity(m_HashMap1) == 8);
+
+    for (size_t key = 6; key < 1000; ++key)
+    {
+        QVERIFY(insertIntHashEntry(key, &m_Values[key], m_HashMap1));
+    }
+
+    QVERIFY(getIntHashMapEntriesCount(m_HashMap1) == 1000 && getIntHashMapCapacity(m_HashMap1) == 2048);
+
+    for (size_t key = 0; key < 1000; ++key)
+    {
+        QVERIFY(getIntHashEntryValue(key, m_HashMap1) == &m_Values[key]);
+    }
+
+    QVERIFY(!getIntHashEntryValue(1000, m_HashMap1));
+}
+
+void IntHashMapTests::testEntriesAreShiftedBackOnErase()
+{
+    m_HashMap1 = createIntHashMap(1024);
+
+    // the map is filled up to the max load factor (768 out of 1024 slots) so the probe sequences get long
+    const size_t stride{(size_t)1 << 20};
+
+    for (size_t index = 0; index < 384; ++index)
+    {
+        QVERIFY(insertIntHashEntry((index + 1) * stride, &m_Values[index], m_HashMap1));
+        QVERIFY(insertIntHashEntry(index, &m_Values[384 + index], m_HashMap1));
+    }
+
+    // erase every other entry, the remaining ones should still be reachable
+    for (size_t index = 0; index < 384; index += 2)
+    {
+        eraseIntHashEntry((index + 1) * stride, m_HashMap1);
+        eraseIntHashEntry(index, m_HashMap1);
+    }
+
+    QVERIFY(getIntHashMapEntriesCount(m_HashMap1) == 384 && getIntHashMapCapacity(m_HashMap1) == 1024);
+
+    for (size_t index = 0; index < 384; ++index)
+    {
+        const bool isErased{index % 2 == 0};
+
+        QVERIFY(getIntHashEntryValue((index + 1) * stride, m_HashMap1) == (isErased ? nullptr : &m_Values[index]));
+        QVERIFY(getIntHashEntryValue(index, m_HashMap1) == (isErased ? nullptr : &m_Values[384 + index]));
+    }
+}
+
+void IntHashMapTests::init()
+{
+    QVERIFY(!m_HashMap1);
+    QVERIFY(!m_HashMap2);
+}
+
+void IntHashMapTests::cleanup()
+{
+    DELETE_INT_HASHMAP(m_HashMap1);
+    DELETE_INT_HASHMAP(m_HashMap2);
+}
+
+QTEST_APPLESS_MAIN(IntHashMapTests)
+
+#include "tst_inthashmaptests.moc"
+// clang-format on
@@ -1,9 +1,13 @@
 // clang-format off
 #include <QTest>
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <string>
 
 #include "listtestfixture.h"
+#include "compactlist.h"
 #include "codeutils.h"
 #include "testobjects.h"
 
@@ -32,6 +36,61 @@ enum class Result
     FAIL
 };
 
+// instrumented allocator: forwards the requests to the elements pool (or heap) and counts the list elements in use
+struct CountingAllocatorContext
+{
+    ListElementsPoolProxy targetProxy;
+    size_t aquiringsCount;
+    size_t releasesCount;
+    size_t elementsInUseCount;
+};
+
+static ListElement* aquireCountedElement(void* context)
+{
+    CountingAllocatorContext* countingContext = static_cast<CountingAllocatorContext*>(context);
+    ListElement* element = aquireListElement(&countingContext->targetProxy);
+
+    ++countingContext->aquiringsCount;
+    countingContext->elementsInUseCount += element ? 1 : 0;
+
+    return element;
+}
+
+static bool aquireCountedElements(void* context, ListElement** elements, size_t requiredElementsCount)
+{
+    CountingAllocatorContext* countingContext = static_cast<CountingAllocatorContext*>(context);
+    const bool aquired = aquireListElements(&countingContext->targetProxy, elements, requiredElementsCount);
+
+    ++countingContext->aquiringsCount;
+    countingContext->elementsInUseCount += aquired ? requiredElementsCount : 0;
+
+    return aquired;
+}
+
+static bool releaseCountedElement(void* context, ListElement* element)
+{
+    CountingAllocatorContext* countingContext = static_cast<CountingAllocatorContext*>(context);
+    const bool released = releaseListElement(element, &countingContext->targetProxy);
+
+    ++countingContext->releasesCount;
+    countingContext->elementsInUseCount -= released ? 1 : 0;
+
+    return released;
+}
+
+static bool releaseCountedElements(void* context, ListElement* first, ListElement* last, size_t elementsCount)
+{
+    CountingAllocatorContext* countingContext = static_cast<CountingAllocatorContext*>(context);
+    const bool released = releaseListElements(&countingContext->targetProxy, first, last, elementsCount);
+
+    ++countingContext->releasesCount;
+    countingContext->elementsInUseCount -= released ? elementsCount : 0;
+
+    return released;
+}
+
+static const ListElementsAllocator countingAllocator{aquireCountedElement, aquireCountedElements, releaseCountedElement, releaseCountedElements};
+
 class LinkedListTests : public QObject
 {
     Q_OBJECT
@@ -52,6 +111,12 @@ private slots:
     void testIsElementContained();
     void testGetPreviousElement();
     void testPrintListElementsToFile();
+    void testCustomElementsAllocator();
+    void testRecycleCache();
+    void testSlabAllocatedPayloads();
+    void testCompactList();
+    void testSharedCompactList();
+    void testCompactPoolSnapshot();
 
     void testAppendOrPrepend_data();
     void testInsertElementBeforeOrAfter_data();
@@ -782,6 +847,446 @@ void LinkedListTests::testPrintListElementsToFile()
     QVERIFY2(success5, "Fifth element is not printed correctly");
 }
 
+void LinkedListTests::testCustomElementsAllocator()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    // static context: it should outlive the lists (which get deleted by fixture cleanup if the test fails)
+    static CountingAllocatorContext countingContext;
+    countingContext = CountingAllocatorContext{{nullptr, nullptr}, 0, 0, 0};
+    initListElementsPoolProxy(&countingContext.targetProxy, pool ? getPoolElementsAllocator() : nullptr, pool);
+
+    const size_t initialAquiredPoolElementsCount = pool ? getAquiredElementsCount(pool) : 0;
+
+    m_Fixture.m_List1 = createEmptyListWithAllocator(&countingAllocator, &countingContext);
+    QVERIFY(m_Fixture.m_List1);
+
+    (void)createAndAppendToList(m_Fixture.m_List1, 4);
+    (void)createAndPrependToList(m_Fixture.m_List1, 2);
+    (void)createAndInsertAfter(lbegin(m_Fixture.m_List1), 3);
+    (void)createAndInsertBefore(lbegin(m_Fixture.m_List1), 1);
+
+    QVERIFY(getListSize(m_Fixture.m_List1) == 4 && countingContext.aquiringsCount == 4 && countingContext.elementsInUseCount == 4);
+    QVERIFY(getListElementAtIndex(m_Fixture.m_List1, 0)->priority == 1 && getListElementAtIndex(m_Fixture.m_List1, 3)->priority == 4);
+    QVERIFY(!pool || getAquiredElementsCount(pool) == initialAquiredPoolElementsCount + 4);
+
+    // the temporary list used for copying inherits the allocator of the destination list
+    m_Fixture.m_List2 = createEmptyListWithAllocator(&countingAllocator, &countingContext);
+    QVERIFY(m_Fixture.m_List2);
+
+    (void)createAndAppendToList(m_Fixture.m_List2, 5);
+    ListElement* const firstCopiedElement = copyContentToList(m_Fixture.m_List1, m_Fixture.m_List2, copyObjectPlaceholder, deleteObjectPayload);
+
+    QVERIFY(firstCopiedElement && firstCopiedElement->priority == 1);
+    QVERIFY(getListSize(m_Fixture.m_List2) == 5 && countingContext.elementsInUseCount == 9);
+
+    ListElement* removedElement = removeFirstListElement(m_Fixture.m_List2);
+    QVERIFY(removedElement && removedElement->priority == 5);
+
+    const bool released = releaseListElement(removedElement, &m_Fixture.m_List2->elementsPoolProxy);
+    QVERIFY(released && countingContext.releasesCount == 1 && countingContext.elementsInUseCount == 8);
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    clearList(m_Fixture.m_List2, deleteObjectPayload);
+
+    QVERIFY(countingContext.elementsInUseCount == 0);
+    QVERIFY(!pool || getAquiredElementsCount(pool) == initialAquiredPoolElementsCount);
+}
+
+void LinkedListTests::testRecycleCache()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    static CountingAllocatorContext countingContext;
+    countingContext = CountingAllocatorContext{{nullptr, nullptr}, 0, 0, 0};
+    initListElementsPoolProxy(&countingContext.targetProxy, pool ? getPoolElementsAllocator() : nullptr, pool);
+
+    const size_t initialAquiredPoolElementsCount = pool ? getAquiredElementsCount(pool) : 0;
+
+    m_Fixture.m_List1 = createEmptyListWithAllocator(&countingAllocator, &countingContext);
+    QVERIFY(m_Fixture.m_List1);
+    QVERIFY(m_Fixture.m_List1->recycleCacheCapacity == 0 && getListRecycledElementsCount(m_Fixture.m_List1) == 0);
+
+    // disabled cache: recycled element is released to allocator
+    ListElement* element = createAndAppendToList(m_Fixture.m_List1, 1);
+    QVERIFY(element && removeFirstListElement(m_Fixture.m_List1) == element);
+    QVERIFY(recycleListElement(m_Fixture.m_List1, element));
+    QVERIFY(countingContext.releasesCount == 1 && countingContext.elementsInUseCount == 0);
+
+    setListRecycleCacheCapacity(m_Fixture.m_List1, LIST_MAX_RECYCLE_CACHE_CAPACITY + 1);
+    QVERIFY(m_Fixture.m_List1->recycleCacheCapacity == LIST_MAX_RECYCLE_CACHE_CAPACITY);
+    setListRecycleCacheCapacity(m_Fixture.m_List1, 2);
+
+    // high churn: the same element gets re-used without allocator round trips
+    element = createAndAppendToList(m_Fixture.m_List1, 2);
+    QVERIFY(element);
+
+    for (Priority priority = 3; priority < 10; ++priority)
+    {
+        QVERIFY(removeLastListElement(m_Fixture.m_List1) == element);
+        QVERIFY(recycleListElement(m_Fixture.m_List1, element) && getListRecycledElementsCount(m_Fixture.m_List1) == 1);
+        QVERIFY(createAndPrependToList(m_Fixture.m_List1, priority) == element);
+        QVERIFY(element->priority == priority && element->object.type == -1 && element->object.payload == nullptr);
+        QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 0);
+    }
+
+    QVERIFY(countingContext.aquiringsCount == 2 && countingContext.elementsInUseCount == 1);
+
+    // the cache is bounded, the excess elements are released
+    for (Priority priority = 10; priority < 13; ++priority)
+    {
+        (void)createAndAppendToList(m_Fixture.m_List1, priority);
+    }
+
+    QVERIFY(getListSize(m_Fixture.m_List1) == 4 && countingContext.elementsInUseCount == 4);
+
+    while (!isEmptyList(m_Fixture.m_List1))
+    {
+        QVERIFY(recycleListElement(m_Fixture.m_List1, removeFirstListElement(m_Fixture.m_List1)));
+    }
+
+    QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 2 && countingContext.elementsInUseCount == 2);
+
+    // cached elements are taken first by all element creating functions
+    (void)createAndAppendToList(m_Fixture.m_List1, 20);
+    (void)createAndInsertAfter(lbegin(m_Fixture.m_List1), 21);
+    (void)createAndInsertBefore(lbegin(m_Fixture.m_List1), 19);
+    QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 0 && countingContext.elementsInUseCount == 3);
+
+    ListElement* const lastElement = removeLastListElement(m_Fixture.m_List1);
+    QVERIFY(lastElement && recycleListElement(m_Fixture.m_List1, lastElement));
+
+    // shrinking the capacity and clearing the list drain the cache back to allocator
+    setListRecycleCacheCapacity(m_Fixture.m_List1, 0);
+    QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 0 && countingContext.elementsInUseCount == 2);
+
+    setListRecycleCacheCapacity(m_Fixture.m_List1, 2);
+    QVERIFY(recycleListElement(m_Fixture.m_List1, removeFirstListElement(m_Fixture.m_List1)));
+    QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 1);
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 0 && countingContext.elementsInUseCount == 0);
+    QVERIFY(!pool || getAquiredElementsCount(pool) == initialAquiredPoolElementsCount);
+}
+
+void LinkedListTests::testSlabAllocatedPayloads()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    m_Fixture.m_List1 = createEmptyList(pool);
+    QVERIFY(m_Fixture.m_List1);
+
+    ListElement* element = createAndAppendToList(m_Fixture.m_List1, 1);
+    assignObjectContentToListElement(element, INTEGER, createSlabIntegerPayload(-5));
+    element = createAndAppendToList(m_Fixture.m_List1, 2);
+    assignObjectContentToListElement(element, POINT, createSlabPointPayload(3, 4));
+    element = createAndAppendToList(m_Fixture.m_List1, 3);
+    assignObjectContentToListElement(element, LOCAL_CONDITIONS, createSlabLocalConditionsPayload(7, 8, 22, 45.5));
+
+    QVERIFY(getSlabTestPayloadsCount() == 3);
+    QVERIFY(*(int*)getListElementAtIndex(m_Fixture.m_List1, 0)->object.payload == -5);
+    QVERIFY(((Point*)getListElementAtIndex(m_Fixture.m_List1, 1)->object.payload)->y == 4);
+    QVERIFY(((LocalConditions*)getListElementAtIndex(m_Fixture.m_List1, 2)->object.payload)->temperature == 22);
+
+    // the memory of a deleted payload is re-used by the next payload of the same type
+    ListElement* removedElement = removeFirstListElement(m_Fixture.m_List1);
+    QVERIFY(removedElement);
+
+    int* const removedPayload = (int*)removedElement->object.payload;
+    deleteSlabTestObjectPayload(&removedElement->object);
+    QVERIFY(!removedElement->object.payload && getSlabTestPayloadsCount() == 2);
+
+    const bool released = releaseListElement(removedElement, &m_Fixture.m_List1->elementsPoolProxy);
+    QVERIFY(released);
+
+    element = createAndPrependToList(m_Fixture.m_List1, 0);
+    assignObjectContentToListElement(element, INTEGER, createSlabIntegerPayload(10));
+
+    QVERIFY(element->object.payload == removedPayload && *removedPayload == 10);
+    QVERIFY(getSlabTestPayloadsCount() == 3);
+
+    clearList(m_Fixture.m_List1, deleteSlabTestObjectPayload);
+
+    QVERIFY(getSlabTestPayloadsCount() == 0);
+
+    deleteTestPayloadSlabs();
+}
+
+void LinkedListTests::testCompactList()
+{
+    CompactElementsPool* compactPool = createCompactElementsPool(2);
+    QVERIFY(compactPool);
+
+    const Priority priorities[4]{3, 1, 4, 1};
+    CompactList* compactList = createCompactListFromPrioritiesArray(priorities, 4, compactPool);
+
+    QVERIFY(compactList && getCompactListSize(compactList) == 4 && getCompactPoolAquiredElementsCount(compactPool) == 4);
+
+    CompactElementId elementId = createAndPrependToCompactList(compactList, 2);
+    QVERIFY(elementId != COMPACT_NULL_ELEMENT_ID && getCompactListElementPriority(compactList, elementId) == 2);
+
+    elementId = createAndAppendToCompactList(compactList, 9);
+    QVERIFY(elementId != COMPACT_NULL_ELEMENT_ID && getCompactListElementPriority(compactList, elementId) == 9);
+
+    assignObjectContentToCompactListElement(compactList, elementId, POINT, createPointPayload(5, 6));
+
+    // priorities not fitting into 32 bits are rejected
+    QVERIFY(createAndAppendToCompactList(compactList, (Priority)UINT32_MAX + 1) == COMPACT_NULL_ELEMENT_ID);
+    QVERIFY(getCompactListSize(compactList) == 6);
+
+    const CompactPriority expectedPriorities[6]{2, 3, 1, 4, 1, 9};
+    CompactPriority actualPriorities[6]{};
+
+    QVERIFY(copyCompactListPriorities(compactList, actualPriorities, 6) == 6);
+    QVERIFY(std::equal(expectedPriorities, expectedPriorities + 6, actualPriorities));
+
+    const CompactObject* object = getCompactListElementObject(compactList, compactList->last);
+    QVERIFY(object && object->type == POINT && ((Point*)object->payload)->y == 6);
+    QVERIFY(getCompactListElementObject(compactList, compactList->first)->type == -1);
+
+    // released elements are re-used first
+    const CompactElementId firstElementId = compactList->first;
+    Object removedObject = removeFirstCompactListElement(compactList);
+
+    QVERIFY(removedObject.type == -1 && !removedObject.payload && getCompactListSize(compactList) == 5);
+    QVERIFY(createAndAppendToCompactList(compactList, 7) == firstElementId && compactList->last == firstElementId);
+
+    // priority-centric operations
+    CompactPriority minPriority{0};
+    CompactPriority maxPriority{0};
+
+    QVERIFY(getCompactListPrioritiesRange(compactList, &minPriority, &maxPriority) && minPriority == 1 && maxPriority == 9);
+    QVERIFY(!isCompactListSortedAscendingByPriority(compactList));
+    QVERIFY(sortCompactListAscendingByPriority(compactList));
+    QVERIFY(isCompactListSortedAscendingByPriority(compactList));
+
+    const CompactPriority sortedPriorities[6]{1, 1, 3, 4, 7, 9};
+
+    QVERIFY(copyCompactListPriorities(compactList, actualPriorities, 6) == 6);
+    QVERIFY(std::equal(sortedPriorities, sortedPriorities + 6, actualPriorities));
+    QVERIFY(compactList->last == elementId && getNextCompactListElementId(compactList, elementId) == COMPACT_NULL_ELEMENT_ID);
+
+    // objects stay attached to their elements
+    object = getCompactListElementObject(compactList, compactList->last);
+    QVERIFY(object && object->type == POINT && ((Point*)object->payload)->x == 5);
+
+    // the pool grows by slices until the maximum slices count is reached
+    for (size_t elementsCount = getCompactListSize(compactList); elementsCount < 2 * COMPACT_POOL_SLICE_SIZE; ++elementsCount)
+    {
+        QVERIFY(createAndAppendToCompactList(compactList, elementsCount) != COMPACT_NULL_ELEMENT_ID);
+    }
+
+    QVERIFY(createAndPrependToCompactList(compactList, 0) == COMPACT_NULL_ELEMENT_ID);
+    QVERIFY(getCompactPoolAquiredElementsCount(compactPool) == 2 * COMPACT_POOL_SLICE_SIZE);
+
+    deleteCompactList(compactList, deleteObjectPayload);
+    compactList = nullptr;
+
+    QVERIFY(getCompactPoolAquiredElementsCount(compactPool) == 0);
+
+    deleteCompactElementsPool(compactPool);
+    compactPool = nullptr;
+
+    // empty list
+    QVERIFY(isCompactListSortedAscendingByPriority(nullptr) && !getCompactListPrioritiesRange(nullptr, &minPriority, &maxPriority));
+}
+
+void LinkedListTests::testSharedCompactList()
+{
+#ifdef UNIX_OS
+    const std::string poolName{"/compact_pool_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())};
+
+    CompactElementsPool* ownerPool = createSharedCompactElementsPool(poolName.c_str(), 2);
+    QVERIFY(ownerPool && isSharedCompactElementsPool(ownerPool));
+
+    // the region name is taken
+    QVERIFY(!createSharedCompactElementsPool(poolName.c_str(), 2));
+
+    // the same region mapped a second time (at a different address), as another process would do
+    CompactElementsPool* attachedPool = openSharedCompactElementsPool(poolName.c_str());
+    QVERIFY(attachedPool && isSharedCompactElementsPool(attachedPool));
+
+    const Priority priorities[5]{6, 2, 7, 3, 4};
+    CompactList* ownerList = createCompactListFromPrioritiesArray(priorities, 5, ownerPool);
+
+    QVERIFY(ownerList && publishCompactList(ownerList, 1));
+    QVERIFY(getCompactPoolAquiredElementsCount(attachedPool) == 5);
+
+    // traverse and sort in place through the second mapping
+    CompactList* attachedList = attachPublishedCompactList(attachedPool, 1);
+    QVERIFY(attachedList && getCompactListSize(attachedList) == 5);
+
+    CompactPriority actualPriorities[5]{};
+    QVERIFY(copyCompactListPriorities(attachedList, actualPriorities, 5) == 5);
+    QVERIFY(std::equal(priorities, priorities + 5, actualPriorities));
+
+    QVERIFY(sortCompactListAscendingByPriority(attachedList) && publishCompactList(attachedList, 1));
+
+    // elements aquired through one mapping are visible through the other one
+    QVERIFY(createAndAppendToCompactList(attachedList, 8) != COMPACT_NULL_ELEMENT_ID && publishCompactList(attachedList, 1));
+    QVERIFY(getCompactPoolAquiredElementsCount(ownerPool) == 6);
+
+    detachCompactList(attachedList);
+    attachedList = nullptr;
+
+    detachCompactList(ownerList);
+    ownerList = attachPublishedCompactList(ownerPool, 1);
+
+    const CompactPriority sortedPriorities[6]{2, 3, 4, 6, 7, 8};
+    CompactPriority ownerPriorities[6]{};
+
+    QVERIFY(ownerList && copyCompactListPriorities(ownerList, ownerPriorities, 6) == 6);
+    QVERIFY(std::equal(sortedPriorities, sortedPriorities + 6, ownerPriorities));
+    QVERIFY(isCompactListSortedAscendingByPriority(ownerList));
+
+    // unused slots and private pools cannot be used for exchanging lists
+    CompactList* emptyList = attachPublishedCompactList(attachedPool, 0);
+    QVERIFY(emptyList && getCompactListSize(emptyList) == 0);
+    QVERIFY(!attachPublishedCompactList(attachedPool, COMPACT_SHARED_LISTS_COUNT));
+
+    detachCompactList(emptyList);
+    emptyList = nullptr;
+
+    deleteCompactList(ownerList, nullptr);
+    ownerList = nullptr;
+
+    QVERIFY(getCompactPoolAquiredElementsCount(attachedPool) == 0);
+
+    deleteCompactElementsPool(attachedPool);
+    attachedPool = nullptr;
+
+    deleteCompactElementsPool(ownerPool);
+    ownerPool = nullptr;
+
+    QVERIFY(!openSharedCompactElementsPool(poolName.c_str()));
+#endif
+}
+
+void LinkedListTests::testCompactPoolSnapshot()
+{
+#ifdef UNIX_OS
+    const std::string snapshotFilePath{"/tmp/compact_pool_snapshot_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".bin"};
+    const char* snapshotFile = snapshotFilePath.c_str();
+
+    CompactElementsPool* compactPool = createCompactElementsPool(4);
+    QVERIFY(compactPool);
+
+    // the first list spans two slices
+    CompactList* firstList = createEmptyCompactList(compactPool);
+    QVERIFY(firstList);
+
+    for (size_t elementIndex = 0; elementIndex < COMPACT_POOL_SLICE_SIZE + 3; ++elementIndex)
+    {
+        QVERIFY(createAndPrependToCompactList(firstList, elementIndex) != COMPACT_NULL_ELEMENT_ID);
+    }
+
+    const Priority priorities[3]{5, 9, 1};
+    CompactList* secondList = createCompactListFromPrioritiesArray(priorities, 3, compactPool);
+    QVERIFY(secondList);
+
+    assignObjectContentToCompactListElement(secondList, secondList->first, INTEGER, createIntegerPayload(4));
+
+    // release one element so the free list gets persisted too
+    const CompactElementId releasedElementId = firstList->first;
+    Q_UNUSED(removeFirstCompactListElement(firstList));
+
+    const CompactList* const lists[2]{firstList, secondList};
+    QVERIFY(saveCompactElementsPoolSnapshot(compactPool, lists, 2, snapshotFile));
+
+    const size_t firstListSize = getCompactListSize(firstList);
+
+    deleteCompactList(secondList, deleteObjectPayload);
+    secondList = nullptr;
+    deleteCompactList(firstList, nullptr);
+    firstList = nullptr;
+    deleteCompactElementsPool(compactPool);
+    compactPool = nullptr;
+
+    // restore
+    compactPool = loadCompactElementsPoolSnapshot(snapshotFile);
+    QVERIFY(compactPool && !isSharedCompactElementsPool(compactPool));
+    QVERIFY(getCompactPoolAquiredElementsCount(compactPool) == firstListSize + 3);
+
+    firstList = attachPublishedCompactList(compactPool, 0);
+    secondList = attachPublishedCompactList(compactPool, 1);
+
+    QVERIFY(firstList && getCompactListSize(firstList) == COMPACT_POOL_SLICE_SIZE + 2);
+    QVERIFY(getCompactListElementPriority(firstList, firstList->first) == COMPACT_POOL_SLICE_SIZE + 1);
+    QVERIFY(getCompactListElementPriority(firstList, firstList->last) == 0);
+
+    CompactPriority secondListPriorities[3]{};
+    QVERIFY(secondList && copyCompactListPriorities(secondList, secondListPriorities, 3) == 3);
+    QVERIFY(secondListPriorities[0] == 5 && secondListPriorities[1] == 9 && secondListPriorities[2] == 1);
+
+    // the objects are not persisted (payloads are process-local)
+    const CompactObject* object = getCompactListElementObject(secondList, secondList->first);
+    QVERIFY(object && object->type == -1 && !object->payload);
+
+    // the restored pool is fully functional: released elements are re-used first, new slices are created on demand
+    QVERIFY(createAndAppendToCompactList(secondList, 7) == releasedElementId);
+
+    for (size_t elementIndex = 0; elementIndex < COMPACT_POOL_SLICE_SIZE; ++elementIndex)
+    {
+        QVERIFY(createAndAppendToCompactList(secondList, elementIndex) != COMPACT_NULL_ELEMENT_ID);
+    }
+
+    QVERIFY(sortCompactListAscendingByPriority(firstList) && isCompactListSortedAscendingByPriority(firstList));
+
+    deleteCompactList(firstList, nullptr);
+    firstList = nullptr;
+    deleteCompactList(secondList, nullptr);
+    secondList = nullptr;
+
+    QVERIFY(getCompactPoolAquiredElementsCount(compactPool) == 0);
+
+    deleteCompactElementsPool(compactPool);
+    compactPool = nullptr;
+
+    // invalid snapshots
+    QVERIFY(!loadCompactElementsPoolSnapshot("/tmp/missing_compact_pool_snapshot.bin"));
+
+    // header layout: magic, slice elements count, slices count, max slices count, aquired elements count, first
+    // available element ID
+    const long aquiredElementsCountOffset{static_cast<long>(2 * sizeof(uint32_t) + 2 * sizeof(size_t))};
+    const long firstAvailableElementIdOffset{aquiredElementsCountOffset + static_cast<long>(sizeof(size_t))};
+    const size_t invalidAquiredElementsCount{3 * COMPACT_POOL_SLICE_SIZE};
+    const CompactElementId invalidElementIds[2]{CompactElementId{2} << 16, COMPACT_POOL_SLICE_SIZE}; // 2 slices saved
+
+    FILE* corruptedSnapshot = fopen(snapshotFile, "r+b");
+    QVERIFY(corruptedSnapshot);
+    size_t aquiredElementsCount{0};
+    QVERIFY(fseek(corruptedSnapshot, aquiredElementsCountOffset, SEEK_SET) == 0 && fread(&aquiredElementsCount, sizeof(size_t), 1, corruptedSnapshot) == 1);
+    QVERIFY(fseek(corruptedSnapshot, aquiredElementsCountOffset, SEEK_SET) == 0 && fwrite(&invalidAquiredElementsCount, sizeof(size_t), 1, corruptedSnapshot) == 1);
+    fflush(corruptedSnapshot);
+
+    QVERIFY(!loadCompactElementsPoolSnapshot(snapshotFile));
+
+    QVERIFY(fseek(corruptedSnapshot, aquiredElementsCountOffset, SEEK_SET) == 0 && fwrite(&aquiredElementsCount, sizeof(size_t), 1, corruptedSnapshot) == 1);
+
+    for (const CompactElementId invalidElementId : invalidElementIds)
+    {
+        QVERIFY(fseek(corruptedSnapshot, firstAvailableElementIdOffset, SEEK_SET) == 0 && fwrite(&invalidElementId, sizeof(CompactElementId), 1, corruptedSnapshot) == 1);
+        fflush(corruptedSnapshot);
+
+        QVERIFY(!loadCompactElementsPoolSnapshot(snapshotFile));
+    }
+
+    fclose(corruptedSnapshot);
+
+    FILE* invalidSnapshot = fopen(snapshotFile, "w");
+    QVERIFY(invalidSnapshot);
+    fputs("no snapshot", invalidSnapshot);
+    fclose(invalidSnapshot);
+
+    QVERIFY(!loadCompactElementsPoolSnapshot(snapshotFile));
+
+    remove(snapshotFile);
+#endif
+}
+
 void LinkedListTests::testAppendOrPrepend_data()
 {
     QTest::addColumn<Priorities>("priorities");
@@ -38,6 +38,14 @@
         releaseElement((listElementRefs)[index], elementsPool); \
     }
 
+#define CHAIN_ELEMENTS(listElementRefs, count) \
+    QVERIFY((listElementRefs)); \
+\
+    for (size_t index = 1; index < count; ++index) \
+    { \
+        (listElementRefs)[index - 1]->next = (listElementRefs)[index]; \
+    }
+
 class ListElementTests : public QObject
 {
     Q_OBJECT
@@ -45,10 +53,18 @@ class ListElementTests : public QObject
 private slots:
     void testAquiringSinglePoolElement();
     void testAquiringMultiplePoolElements();
+    void testReleasingMultiplePoolElements();
+    void testAquiringPoolElementsWithLocalityPolicy();
     void testOptimizingPoolCapacity();
+    void testCompactingPool();
+    void testCompactingPoolWithRecycledElements();
+    void testMappedPoolBacking();
+    void testPoolStats();
+    void testArenaAllocation();
     void testAllPoolElementsAquired();
     void testAssignRemoveObject();
     void testCustomCopyObject();
+    void testInlineObjects();
 
     void initTestCase_data();
     void cleanupTestCase();
@@ -371,6 +387,225 @@ void ListElementTests::testAquiringMultiplePoolElements()
     QVERIFY(!multipleElementsAquired);
 }
 
+void ListElementTests::testReleasingMultiplePoolElements()
+{
+    m_Fixture.m_TempPool1 = createListElementsPool(USE_DEFAULT_MAX_SLICES_COUNT);
+    QVERIFY(m_Fixture.m_TempPool1);
+
+    // batch 1: spread across two slices, released as a single chain
+    const size_t batchSize1 = ELEMENTS_POOL_SLICE_SIZE + 10;
+    ListElement** listElementRefs1 = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs1, batchSize1, m_Fixture);
+
+    bool multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs1, batchSize1);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, ELEMENTS_POOL_SLICE_SIZE + 10, ELEMENTS_POOL_SLICE_SIZE - 10);
+
+    CHAIN_ELEMENTS(listElementRefs1, batchSize1);
+
+    for (size_t index = 0; index < batchSize1; ++index)
+    {
+        listElementRefs1[index]->priority = index + 1;
+    }
+
+    bool released = releaseElements(m_Fixture.m_TempPool1, listElementRefs1[0], listElementRefs1[batchSize1 - 1], batchSize1);
+
+    QVERIFY(released);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs1, batchSize1); // released elements should have been re-initialized
+    QVERIFY(!listElementRefs1[batchSize1 - 1]->next);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 2 * ELEMENTS_POOL_SLICE_SIZE);
+
+    // batch 2: released partially as chain, partially element by element
+    const size_t batchSize2 = ELEMENTS_POOL_SLICE_SIZE + ELEMENTS_POOL_SLICE_SIZE / 2;
+    const size_t chainedElementsCount = ELEMENTS_POOL_SLICE_SIZE;
+    ListElement** listElementRefs2 = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs2, batchSize2, m_Fixture);
+
+    multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs2, batchSize2);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs2, batchSize2);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize2, 2 * ELEMENTS_POOL_SLICE_SIZE - batchSize2);
+
+    CHAIN_ELEMENTS(listElementRefs2, chainedElementsCount);
+    released = releaseElements(m_Fixture.m_TempPool1, listElementRefs2[0], listElementRefs2[chainedElementsCount - 1], chainedElementsCount);
+
+    QVERIFY(released);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize2 - chainedElementsCount, 2 * ELEMENTS_POOL_SLICE_SIZE - batchSize2 + chainedElementsCount);
+
+    RELEASE_ELEMENTS(listElementRefs2 + chainedElementsCount, batchSize2 - chainedElementsCount, m_Fixture.m_TempPool1);
+    listElementRefs2 = nullptr;
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 2 * ELEMENTS_POOL_SLICE_SIZE);
+
+    // list level: all list elements are returned to pool when clearing the list
+    const Priority prioritiesArray[10]{6, 2, 5, 4, 3, 1, 2, 9, 7, 8};
+    m_Fixture.m_List1 = createListFromPrioritiesArray(prioritiesArray, 10, m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List1);
+
+    for (size_t index = 0; index < 2 * ELEMENTS_POOL_SLICE_SIZE; ++index)
+    {
+        QVERIFY(createAndAppendToList(m_Fixture.m_List1, index));
+    }
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 2 * ELEMENTS_POOL_SLICE_SIZE + 10, ELEMENTS_POOL_SLICE_SIZE - 10);
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+
+    QVERIFY(isEmptyList(m_Fixture.m_List1));
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 3 * ELEMENTS_POOL_SLICE_SIZE);
+
+    // additional corner cases
+    ListElement* element = aquireElement(m_Fixture.m_TempPool1);
+    QVERIFY(element);
+
+    released = releaseElements(nullptr, element, element, 1);
+    QVERIFY(!released);
+
+    released = releaseElements(m_Fixture.m_TempPool1, nullptr, element, 1);
+    QVERIFY(!released);
+
+    released = releaseElements(m_Fixture.m_TempPool1, element, nullptr, 1);
+    QVERIFY(!released);
+
+    released = releaseElements(m_Fixture.m_TempPool1, element, element, 0);
+    QVERIFY(!released);
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 1, 3 * ELEMENTS_POOL_SLICE_SIZE - 1);
+
+    released = releaseElements(m_Fixture.m_TempPool1, element, element, 1);
+    QVERIFY(released);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 3 * ELEMENTS_POOL_SLICE_SIZE);
+}
+
+void ListElementTests::testAquiringPoolElementsWithLocalityPolicy()
+{
+    m_Fixture.m_TempPool1 = createListElementsPool(USE_DEFAULT_MAX_SLICES_COUNT);
+    QVERIFY(m_Fixture.m_TempPool1);
+    QVERIFY(getElementsAquiringPolicy(m_Fixture.m_TempPool1) == LIFO_AQUIRING_POLICY);
+
+    setElementsAquiringPolicy(m_Fixture.m_TempPool1, LOCALITY_AQUIRING_POLICY);
+    QVERIFY(getElementsAquiringPolicy(m_Fixture.m_TempPool1) == LOCALITY_AQUIRING_POLICY);
+
+    // batch 1: consecutively aquired elements should be adjacent in memory
+    const size_t batchSize1 = ELEMENTS_POOL_SLICE_SIZE - 8;
+    ListElement** listElementRefs1 = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs1, batchSize1, m_Fixture);
+
+    bool multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs1, batchSize1);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs1, batchSize1);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize1, 8);
+
+    for (size_t index = 1; index < batchSize1; ++index)
+    {
+        QVERIFY(listElementRefs1[index] == listElementRefs1[index - 1] + 1);
+    }
+
+    // released "gaps" are filled in starting with the lowest address
+    ListElement* const firstGap = listElementRefs1[3];
+    ListElement* const secondGap = listElementRefs1[70];
+
+    bool released = releaseElement(secondGap, m_Fixture.m_TempPool1);
+    QVERIFY(released);
+
+    released = releaseElement(firstGap, m_Fixture.m_TempPool1);
+    QVERIFY(released);
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize1 - 2, 10);
+
+    ListElement* element = aquireElement(m_Fixture.m_TempPool1);
+    QVERIFY(element == firstGap);
+
+    element = aquireElement(m_Fixture.m_TempPool1);
+    QVERIFY(element == secondGap);
+
+    element = aquireElement(m_Fixture.m_TempPool1);
+    QVERIFY(element == listElementRefs1[batchSize1 - 1] + 1);
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize1 + 1, 7);
+
+    // batch 2: a new slice is created, the first one (most populated) gets filled in first
+    const size_t batchSize2 = 10;
+    ListElement** listElementRefs2 = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs2, batchSize2, m_Fixture);
+
+    multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs2, batchSize2);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs2, batchSize2);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize1 + 11, ELEMENTS_POOL_SLICE_SIZE - 3);
+
+    for (size_t index = 0; index < 7; ++index)
+    {
+        QVERIFY(listElementRefs2[index] == element + index + 1);
+    }
+
+    for (size_t index = 8; index < batchSize2; ++index)
+    {
+        QVERIFY(listElementRefs2[index] == listElementRefs2[index - 1] + 1);
+    }
+
+    // list elements appended one by one are adjacent too
+    m_Fixture.m_List1 = createEmptyList(m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List1);
+
+    ListElement* previousListElement = createAndAppendToList(m_Fixture.m_List1, 1);
+    QVERIFY(previousListElement == listElementRefs2[batchSize2 - 1] + 1);
+
+    for (Priority priority = 2; priority <= 5; ++priority)
+    {
+        ListElement* currentListElement = createAndAppendToList(m_Fixture.m_List1, priority);
+        QVERIFY(currentListElement == previousListElement + 1);
+        previousListElement = currentListElement;
+    }
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize1 + 16, ELEMENTS_POOL_SLICE_SIZE - 8);
+
+    // switching back to LIFO policy: the released elements should be available again and aquired elements should not be handed out twice
+    RELEASE_ELEMENTS(listElementRefs2, batchSize2, m_Fixture.m_TempPool1);
+    listElementRefs2 = nullptr;
+
+    setElementsAquiringPolicy(m_Fixture.m_TempPool1, LIFO_AQUIRING_POLICY);
+    QVERIFY(getElementsAquiringPolicy(m_Fixture.m_TempPool1) == LIFO_AQUIRING_POLICY);
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, batchSize1 + 6, ELEMENTS_POOL_SLICE_SIZE + 2);
+
+    const size_t batchSize3 = ELEMENTS_POOL_SLICE_SIZE + 2;
+    ListElement** listElementRefs3 = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs3, batchSize3, m_Fixture);
+
+    multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs3, batchSize3);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs3, batchSize3);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 2 * ELEMENTS_POOL_SLICE_SIZE, 0);
+
+    for (size_t index = 0; index < batchSize3; ++index)
+    {
+        QVERIFY(listElementRefs3[index] != element && !isListElementContained(listElementRefs3[index], m_Fixture.m_List1));
+
+        for (size_t aquiredElementIndex = 0; aquiredElementIndex < batchSize1; ++aquiredElementIndex)
+        {
+            QVERIFY(listElementRefs3[index] != listElementRefs1[aquiredElementIndex]);
+        }
+    }
+
+    RELEASE_ELEMENTS(listElementRefs3, batchSize3, m_Fixture.m_TempPool1);
+    listElementRefs3 = nullptr;
+
+    RELEASE_ELEMENTS(listElementRefs1, batchSize1, m_Fixture.m_TempPool1);
+    listElementRefs1 = nullptr;
+
+    released = releaseElement(element, m_Fixture.m_TempPool1);
+    QVERIFY(released);
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 2 * ELEMENTS_POOL_SLICE_SIZE);
+}
+
 void ListElementTests::testOptimizingPoolCapacity()
 {
     /* first pool: simple test for optimizing capacity */
@@ -623,6 +858,379 @@ void ListElementTests::testOptimizingPoolCapacity()
     CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool2, 0, ELEMENTS_POOL_SLICE_SIZE);
 }
 
+void ListElementTests::testCompactingPool()
+{
+    m_Fixture.m_TempPool1 = createListElementsPool(USE_DEFAULT_MAX_SLICES_COUNT);
+    QVERIFY(m_Fixture.m_TempPool1);
+
+    m_Fixture.m_List1 = createEmptyList(m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List1);
+
+    m_Fixture.m_List2 = createEmptyList(m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List2);
+
+    for (size_t index = 0; index < 3 * ELEMENTS_POOL_SLICE_SIZE; ++index)
+    {
+        QVERIFY(createAndAppendToList(m_Fixture.m_List1, index));
+    }
+
+    for (size_t index = 0; index < ELEMENTS_POOL_SLICE_SIZE; ++index)
+    {
+        QVERIFY(createAndAppendToList(m_Fixture.m_List2, 2 * index));
+    }
+
+    QVERIFY(getAquiredElementsCount(m_Fixture.m_TempPool1) == 4 * ELEMENTS_POOL_SLICE_SIZE);
+
+    // keep only each 8th element of the first list so its elements get scattered among the first slices
+    const size_t elementsStep = 8;
+    ListIterator it = lbegin(m_Fixture.m_List1);
+
+    while (!areIteratorsEqual(it, lend(m_Fixture.m_List1)))
+    {
+        for (size_t removalIndex = 1; removalIndex < elementsStep && it.current->next != nullptr; ++removalIndex)
+        {
+            ListElement* removedElement = removeNextListElement(it);
+            QVERIFY(removedElement);
+
+            const bool released = releaseElement(removedElement, m_Fixture.m_TempPool1);
+            QVERIFY(released);
+        }
+
+        lnext(&it);
+    }
+
+    const size_t list1Size = 3 * ELEMENTS_POOL_SLICE_SIZE / elementsStep;
+    QVERIFY(getListSize(m_Fixture.m_List1) == list1Size);
+    QVERIFY(getAquiredElementsCount(m_Fixture.m_TempPool1) == list1Size + ELEMENTS_POOL_SLICE_SIZE);
+
+    // compacting should be refused if not all aquired elements belong to the passed lists
+    const size_t availableElementsCount = getAvailableElementsCount(m_Fixture.m_TempPool1);
+    List* lists[2] = {m_Fixture.m_List1, m_Fixture.m_List2};
+    bool compacted = compactListElementsPool(m_Fixture.m_TempPool1, lists, 1);
+
+    QVERIFY(!compacted);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, list1Size + ELEMENTS_POOL_SLICE_SIZE, availableElementsCount);
+
+    compacted = compactListElementsPool(m_Fixture.m_TempPool1, lists, 2);
+
+    QVERIFY(compacted);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, list1Size + ELEMENTS_POOL_SLICE_SIZE, ELEMENTS_POOL_SLICE_SIZE - list1Size);
+
+    // the order and content of the lists elements should be preserved
+    QVERIFY(getListSize(m_Fixture.m_List1) == list1Size && getListSize(m_Fixture.m_List2) == ELEMENTS_POOL_SLICE_SIZE);
+    QVERIFY(m_Fixture.m_List1->last && m_Fixture.m_List1->last->priority == (list1Size - 1) * elementsStep && !m_Fixture.m_List1->last->next);
+    QVERIFY(m_Fixture.m_List2->last && m_Fixture.m_List2->last->priority == 2 * (ELEMENTS_POOL_SLICE_SIZE - 1) && !m_Fixture.m_List2->last->next);
+
+    size_t elementIndex = 0;
+
+    for (it = lbegin(m_Fixture.m_List1); !areIteratorsEqual(it, lend(m_Fixture.m_List1)); lnext(&it))
+    {
+        QVERIFY(it.current->priority == elementIndex * elementsStep);
+        ++elementIndex;
+    }
+
+    elementIndex = 0;
+
+    for (it = lbegin(m_Fixture.m_List2); !areIteratorsEqual(it, lend(m_Fixture.m_List2)); lnext(&it))
+    {
+        QVERIFY(it.current->priority == 2 * elementIndex);
+        ++elementIndex;
+    }
+
+    // newly aquired elements should not overlap the relocated ones
+    const size_t batchSize = ELEMENTS_POOL_SLICE_SIZE - list1Size;
+    ListElement** listElementRefs = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs, batchSize, m_Fixture);
+
+    const bool multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs, batchSize);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs, batchSize);
+
+    for (size_t index = 0; index < batchSize; ++index)
+    {
+        QVERIFY(!isListElementContained(listElementRefs[index], m_Fixture.m_List1) &&
+                !isListElementContained(listElementRefs[index], m_Fixture.m_List2));
+    }
+
+    RELEASE_ELEMENTS(listElementRefs, batchSize, m_Fixture.m_TempPool1);
+    listElementRefs = nullptr;
+
+    sortDescendingByPriority(m_Fixture.m_List1);
+    QVERIFY(m_Fixture.m_List1->first && m_Fixture.m_List1->first->priority == (list1Size - 1) * elementsStep);
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    clearList(m_Fixture.m_List2, deleteObjectPayload);
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 2 * ELEMENTS_POOL_SLICE_SIZE);
+}
+
+void ListElementTests::testCompactingPoolWithRecycledElements()
+{
+    m_Fixture.m_TempPool1 = createListElementsPool(USE_DEFAULT_MAX_SLICES_COUNT);
+    QVERIFY(m_Fixture.m_TempPool1);
+
+    m_Fixture.m_List1 = createEmptyList(m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List1);
+
+    const size_t recycleCacheCapacity = 16;
+    setListRecycleCacheCapacity(m_Fixture.m_List1, recycleCacheCapacity);
+
+    for (size_t index = 0; index < 2 * ELEMENTS_POOL_SLICE_SIZE; ++index)
+    {
+        QVERIFY(createAndAppendToList(m_Fixture.m_List1, index));
+    }
+
+    // the first removed elements are cached by the list (they remain aquired), the other ones are released to the pool
+    const size_t list1Size = 4;
+
+    for (size_t index = 0; index < 2 * ELEMENTS_POOL_SLICE_SIZE - list1Size; ++index)
+    {
+        ListElement* removedElement = removeFirstListElement(m_Fixture.m_List1);
+        QVERIFY(removedElement);
+
+        const bool recycled = recycleListElement(m_Fixture.m_List1, removedElement);
+        QVERIFY(recycled);
+    }
+
+    QVERIFY(getListSize(m_Fixture.m_List1) == list1Size && getListRecycledElementsCount(m_Fixture.m_List1) == recycleCacheCapacity);
+    QVERIFY(getAquiredElementsCount(m_Fixture.m_TempPool1) == list1Size + recycleCacheCapacity);
+
+    // the recycled elements are accounted for and released to the pool, the remaining elements are moved to a single slice
+    List* lists[1] = {m_Fixture.m_List1};
+    const bool compacted = compactListElementsPool(m_Fixture.m_TempPool1, lists, 1);
+
+    QVERIFY(compacted);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, list1Size, ELEMENTS_POOL_SLICE_SIZE - list1Size);
+    QVERIFY(getListRecycledElementsCount(m_Fixture.m_List1) == 0 && m_Fixture.m_List1->recycleCacheCapacity == recycleCacheCapacity);
+
+    size_t elementIndex = 0;
+
+    for (ListIterator it = lbegin(m_Fixture.m_List1); !areIteratorsEqual(it, lend(m_Fixture.m_List1)); lnext(&it))
+    {
+        QVERIFY(it.current->priority == 2 * ELEMENTS_POOL_SLICE_SIZE - list1Size + elementIndex);
+        ++elementIndex;
+    }
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, ELEMENTS_POOL_SLICE_SIZE);
+}
+
+void ListElementTests::testMappedPoolBacking()
+{
+    m_Fixture.m_TempPool1 = createListElementsPoolWithBacking(3, MAPPED_POOL_BACKING);
+    QVERIFY(m_Fixture.m_TempPool1);
+
+    const bool isMapped = getElementsPoolBacking(m_Fixture.m_TempPool1) == MAPPED_POOL_BACKING;
+    const bool prefaulted = prefaultListElementsPool(m_Fixture.m_TempPool1);
+
+    QVERIFY(prefaulted == isMapped);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, ELEMENTS_POOL_SLICE_SIZE);
+
+    // all slices get created
+    m_Fixture.m_List1 = createEmptyList(m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List1);
+
+    for (size_t index = 0; index <= 2 * ELEMENTS_POOL_SLICE_SIZE; ++index)
+    {
+        QVERIFY(createAndAppendToList(m_Fixture.m_List1, index));
+    }
+
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 2 * ELEMENTS_POOL_SLICE_SIZE + 1, ELEMENTS_POOL_SLICE_SIZE - 1);
+
+    // elements of the second slice get released, then the slice gets deleted and its memory reused by a new slice
+    ListElement* lastKeptElement = getListElementAtIndex(m_Fixture.m_List1, ELEMENTS_POOL_SLICE_SIZE - 1);
+    ListElement* firstReleasedElement = lastKeptElement ? lastKeptElement->next : nullptr;
+    ListElement* lastReleasedElement = getListElementAtIndex(m_Fixture.m_List1, 2 * ELEMENTS_POOL_SLICE_SIZE - 1);
+    QVERIFY(lastKeptElement && lastReleasedElement);
+
+    lastKeptElement->next = lastReleasedElement->next;
+    lastReleasedElement->next = nullptr;
+
+    const bool released = releaseElements(m_Fixture.m_TempPool1, firstReleasedElement, lastReleasedElement, ELEMENTS_POOL_SLICE_SIZE);
+    QVERIFY(released);
+
+    shrinkPoolCapacity(m_Fixture.m_TempPool1);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, ELEMENTS_POOL_SLICE_SIZE + 1, ELEMENTS_POOL_SLICE_SIZE - 1);
+
+    const size_t batchSize = 2 * ELEMENTS_POOL_SLICE_SIZE - 1;
+    ListElement** listElementRefs = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs, batchSize, m_Fixture);
+
+    const bool multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs, batchSize);
+
+    QVERIFY(multipleElementsAquired);
+    CHECK_AQUIRED_ELEMENTS(listElementRefs, batchSize);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 3 * ELEMENTS_POOL_SLICE_SIZE, 0);
+
+    for (size_t index = 0; index < batchSize; ++index)
+    {
+        QVERIFY(!isListElementContained(listElementRefs[index], m_Fixture.m_List1));
+    }
+
+    // the content of the elements is preserved by pre-faulting (again)
+    QVERIFY(prefaultListElementsPool(m_Fixture.m_TempPool1) == isMapped);
+    QVERIFY(getListSize(m_Fixture.m_List1) == ELEMENTS_POOL_SLICE_SIZE + 1);
+    QVERIFY(lastKeptElement->priority == ELEMENTS_POOL_SLICE_SIZE - 1 && m_Fixture.m_List1->last->priority == 2 * ELEMENTS_POOL_SLICE_SIZE);
+
+    RELEASE_ELEMENTS(listElementRefs, batchSize, m_Fixture.m_TempPool1);
+    listElementRefs = nullptr;
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    CHECK_AQUIRED_AND_AVAILABLE_ELEMENTS_COUNT(m_Fixture.m_TempPool1, 0, 3 * ELEMENTS_POOL_SLICE_SIZE);
+
+    // heap backed pool: nothing to pre-fault
+    m_Fixture.m_TempPool2 = createListElementsPoolWithBacking(USE_DEFAULT_MAX_SLICES_COUNT, HEAP_POOL_BACKING);
+    QVERIFY(m_Fixture.m_TempPool2);
+    QVERIFY(getElementsPoolBacking(m_Fixture.m_TempPool2) == HEAP_POOL_BACKING && !prefaultListElementsPool(m_Fixture.m_TempPool2));
+}
+
+void ListElementTests::testPoolStats()
+{
+    m_Fixture.m_TempPool1 = createListElementsPool(2);
+    QVERIFY(m_Fixture.m_TempPool1);
+
+    ListElementsPoolStats stats;
+    bool statsRetrieved = getListElementsPoolStats(m_Fixture.m_TempPool1, &stats);
+
+    QVERIFY(statsRetrieved);
+    QVERIFY(stats.createdSlicesCount == 1 && stats.deletedSlicesCount == 0 && stats.peakAquiredElementsCount == 0);
+    QVERIFY(stats.slicesOccupancy[0] == 1 && stats.slicesOccupancy[POOL_OCCUPANCY_BUCKETS_COUNT - 1] == 0);
+    QVERIFY(stats.sampledAquiringsCount == 0 && stats.averageAquiringLatency == 0 && stats.maxAquiringLatency == 0);
+
+    const size_t batchSize = 2 * ELEMENTS_POOL_SLICE_SIZE;
+    ListElement** listElementRefs = nullptr;
+    ALLOC_LIST_ELEMENT_REFS(listElementRefs, batchSize, m_Fixture);
+
+    bool multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs, ELEMENTS_POOL_SLICE_SIZE + 10);
+    QVERIFY(multipleElementsAquired);
+
+    // too many elements required at once
+    multipleElementsAquired = aquireElements(m_Fixture.m_TempPool1, listElementRefs + ELEMENTS_POOL_SLICE_SIZE + 10, batchSize);
+    QVERIFY(!multipleElementsAquired);
+
+    statsRetrieved = getListElementsPoolStats(m_Fixture.m_TempPool1, &stats);
+
+    QVERIFY(statsRetrieved);
+    QVERIFY(stats.createdSlicesCount == 2 && stats.aquiredElementsCount == ELEMENTS_POOL_SLICE_SIZE + 10 && stats.failedAquiringsCount == 1);
+    QVERIFY(stats.peakAquiredElementsCount == ELEMENTS_POOL_SLICE_SIZE + 10);
+    QVERIFY(stats.slicesOccupancy[1] == 1 && stats.slicesOccupancy[POOL_OCCUPANCY_BUCKETS_COUNT - 1] == 1);
+
+    // pool exhausted (maximum slices count reached)
+    for (size_t index = ELEMENTS_POOL_SLICE_SIZE + 10; index < batchSize; ++index)
+    {
+        listElementRefs[index] = aquireElement(m_Fixture.m_TempPool1);
+        QVERIFY(listElementRefs[index]);
+    }
+
+    QVERIFY(!aquireElement(m_Fixture.m_TempPool1));
+
+    RELEASE_ELEMENTS(listElementRefs, ELEMENTS_POOL_SLICE_SIZE + 10, m_Fixture.m_TempPool1);
+
+    const bool released = releaseElements(m_Fixture.m_TempPool1, nullptr, nullptr, 0);
+    QVERIFY(!released);
+
+    statsRetrieved = getListElementsPoolStats(m_Fixture.m_TempPool1, &stats);
+
+    QVERIFY(statsRetrieved);
+    QVERIFY(stats.aquiredElementsCount == batchSize && stats.releasedElementsCount == ELEMENTS_POOL_SLICE_SIZE + 10);
+    QVERIFY(stats.peakAquiredElementsCount == batchSize && stats.failedAquiringsCount == 2);
+
+    RELEASE_ELEMENTS(listElementRefs + ELEMENTS_POOL_SLICE_SIZE + 10, batchSize - ELEMENTS_POOL_SLICE_SIZE - 10, m_Fixture.m_TempPool1);
+    listElementRefs = nullptr;
+
+    shrinkPoolCapacity(m_Fixture.m_TempPool1);
+    statsRetrieved = getListElementsPoolStats(m_Fixture.m_TempPool1, &stats);
+
+    QVERIFY(statsRetrieved);
+    QVERIFY(stats.createdSlicesCount == 2 && stats.deletedSlicesCount == 1 && stats.releasedElementsCount == batchSize);
+    QVERIFY(stats.slicesOccupancy[0] == 1 && stats.slicesOccupancy[POOL_OCCUPANCY_BUCKETS_COUNT - 1] == 0);
+
+    // latency sampling (each second aquiring call)
+    resetListElementsPoolStats(m_Fixture.m_TempPool1);
+    setAquiringLatencySamplingPeriod(m_Fixture.m_TempPool1, 2);
+
+    m_Fixture.m_List1 = createEmptyList(m_Fixture.m_TempPool1);
+    QVERIFY(m_Fixture.m_List1);
+
+    for (size_t index = 0; index < 8; ++index)
+    {
+        QVERIFY(createAndAppendToList(m_Fixture.m_List1, index));
+    }
+
+    statsRetrieved = getListElementsPoolStats(m_Fixture.m_TempPool1, &stats);
+
+    QVERIFY(statsRetrieved);
+    QVERIFY(stats.createdSlicesCount == 0 && stats.deletedSlicesCount == 0 && stats.aquiredElementsCount == 8 && stats.releasedElementsCount == 0);
+    QVERIFY(stats.sampledAquiringsCount == 4 && stats.averageAquiringLatency <= stats.maxAquiringLatency);
+
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    resetListElementsPoolStats(m_Fixture.m_TempPool1);
+    statsRetrieved = getListElementsPoolStats(m_Fixture.m_TempPool1, &stats);
+
+    QVERIFY(statsRetrieved);
+    QVERIFY(stats.peakAquiredElementsCount == 0 && stats.aquiredElementsCount == 0 && stats.sampledAquiringsCount == 0);
+    QVERIFY(!getListElementsPoolStats(m_Fixture.m_TempPool1, nullptr));
+}
+
+void ListElementTests::testArenaAllocation()
+{
+    const size_t blockSize = 16;
+    m_Fixture.m_TempArena = createListElementsArena(blockSize);
+    QVERIFY(m_Fixture.m_TempArena);
+
+    const size_t prioritiesCount = 2 * blockSize + 8;
+    Priority prioritiesArray[prioritiesCount];
+
+    for (size_t index = 0; index < prioritiesCount; ++index)
+    {
+        prioritiesArray[index] = prioritiesCount - index;
+    }
+
+    m_Fixture.m_List1 = createListFromPrioritiesArrayWithAllocator(prioritiesArray, prioritiesCount, getArenaElementsAllocator(), m_Fixture.m_TempArena);
+    QVERIFY(m_Fixture.m_List1);
+    QVERIFY(getListSize(m_Fixture.m_List1) == prioritiesCount && getArenaAquiredElementsCount(m_Fixture.m_TempArena) == prioritiesCount);
+
+    ListElement* const firstAquiredElement = m_Fixture.m_List1->first;
+
+    // elements of the same block are adjacent
+    for (size_t index = 1; index < blockSize; ++index)
+    {
+        QVERIFY(getListElementAtIndex(m_Fixture.m_List1, index) == firstAquiredElement + index);
+    }
+
+    sortAscendingByPriority(m_Fixture.m_List1);
+    QVERIFY(isSortedAscendingByPriority(m_Fixture.m_List1) && m_Fixture.m_List1->first->priority == 1);
+
+    // releasing elements has no effect on arena
+    ListElement* removedElement = removeFirstListElement(m_Fixture.m_List1);
+    QVERIFY(removedElement);
+
+    const bool released = releaseListElement(removedElement, &m_Fixture.m_List1->elementsPoolProxy);
+    QVERIFY(released && getArenaAquiredElementsCount(m_Fixture.m_TempArena) == prioritiesCount);
+
+    m_Fixture.m_List2 = createEmptyListWithAllocator(getArenaElementsAllocator(), m_Fixture.m_TempArena);
+    QVERIFY(m_Fixture.m_List2);
+
+    ListElement* appendedElement = createAndAppendToList(m_Fixture.m_List2, 5);
+    QVERIFY(appendedElement && appendedElement->object.type == -1 && appendedElement->object.payload == nullptr && !appendedElement->next);
+    assignObjectContentToListElement(appendedElement, INTEGER, createIntegerPayload(3));
+    QVERIFY(getArenaAquiredElementsCount(m_Fixture.m_TempArena) == prioritiesCount + 1);
+
+    // the lists should be cleared before resetting (objects deallocation)
+    clearList(m_Fixture.m_List1, deleteObjectPayload);
+    clearList(m_Fixture.m_List2, deleteObjectPayload);
+    QVERIFY(getArenaAquiredElementsCount(m_Fixture.m_TempArena) == prioritiesCount + 1);
+
+    resetListElementsArena(m_Fixture.m_TempArena);
+    QVERIFY(getArenaAquiredElementsCount(m_Fixture.m_TempArena) == 0);
+
+    // the first block is reused
+    appendedElement = createAndAppendToList(m_Fixture.m_List2, 7);
+    QVERIFY(appendedElement == firstAquiredElement && appendedElement->priority == 7 && appendedElement->object.payload == nullptr);
+    QVERIFY(getArenaAquiredElementsCount(m_Fixture.m_TempArena) == 1);
+}
+
 void ListElementTests::testAllPoolElementsAquired()
 {
     /* First scenario: pool can be extended by adding slice */
@@ -990,6 +1598,72 @@ void ListElementTests::testCustomCopyObject()
     clearObject(destination);
 }
 
+void ListElementTests::testInlineObjects()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    m_Fixture.m_List1 = createEmptyList(pool);
+
+    const int integer{0}; // zero payload bytes, the object should still be non-empty
+    const double decimal{-2.5};
+    const Point point{3, 4};
+
+    QVERIFY(assignInlineObjectContentToListElement(createAndAppendToList(m_Fixture.m_List1, 1), INTEGER, &integer, sizeof(integer)));
+    QVERIFY(assignInlineObjectContentToListElement(createAndAppendToList(m_Fixture.m_List1, 2), DECIMAL, &decimal, sizeof(decimal)));
+    QVERIFY(assignInlineObjectContentToListElement(createAndAppendToList(m_Fixture.m_List1, 3), POINT, &point, sizeof(point)));
+    assignObjectContentToListElement(createAndAppendToList(m_Fixture.m_List1, 4), SEGMENT, createSegmentPayload(1, 2, 3, 4));
+
+    // too large for being stored inline
+    ListElement* const element = createAndAppendToList(m_Fixture.m_List1, 5);
+    QVERIFY(sizeof(LocalConditions) > OBJECT_INLINE_PAYLOAD_SIZE);
+    QVERIFY(!assignInlineObjectContentToListElement(element, LOCAL_CONDITIONS, &decimal, OBJECT_INLINE_PAYLOAD_SIZE + 1));
+    QVERIFY(isEmptyObject(&element->object) && element->object.type == -1);
+
+    ListIterator it = lbegin(m_Fixture.m_List1);
+    QVERIFY(isInlineObject(&it.current->object) && !isEmptyObject(&it.current->object));
+    QVERIFY(getObjectType(&it.current->object) == INTEGER && *(int*)getObjectPayload(&it.current->object) == 0);
+
+    lnext(&it);
+    QVERIFY(isInlineObject(&it.current->object) && getObjectType(&it.current->object) == DECIMAL);
+    QVERIFY(areDecimalNumbersEqual(*(double*)getObjectPayload(&it.current->object), -2.5));
+
+    lnext(&it);
+    QVERIFY(isInlineObject(&it.current->object) && getObjectType(&it.current->object) == POINT);
+    QVERIFY(((Point*)getObjectPayload(&it.current->object))->x == 3 && ((Point*)getObjectPayload(&it.current->object))->y == 4);
+
+    lnext(&it);
+    QVERIFY(!isInlineObject(&it.current->object) && getObjectType(&it.current->object) == SEGMENT);
+    QVERIFY(getObjectPayload(&it.current->object) == it.current->object.payload);
+
+    // default copy function handles inline objects
+    ListElement* const pointElement = getListElementAtIndex(m_Fixture.m_List1, 2);
+
+    QVERIFY(copyObjectPlaceholder(pointElement, element));
+    QVERIFY(getObjectType(&element->object) == POINT && ((Point*)getObjectPayload(&element->object))->x == 3);
+
+    // the inline payload gets copied together with the element (the copy function only needs to handle the other objects)
+    m_Fixture.m_List2 = createEmptyList(pool);
+    ListElement* const firstCopiedElement = copyContentToList(m_Fixture.m_List1, m_Fixture.m_List2, customCopyObject, emptyTestObject);
+
+    QVERIFY(firstCopiedElement && getListSize(m_Fixture.m_List2) == 5);
+    QVERIFY(isInlineObject(&firstCopiedElement->object) && getObjectPayload(&firstCopiedElement->object) != getObjectPayload(&lbegin(m_Fixture.m_List1).current->object));
+    QVERIFY(getObjectType(&getListElementAtIndex(m_Fixture.m_List2, 4)->object) == POINT && ((Point*)getObjectPayload(&getListElementAtIndex(m_Fixture.m_List2, 4)->object))->y == 4);
+
+    // detached inline objects keep their payload
+    Object removedObject = detachContentFromListElement(getListElementAtIndex(m_Fixture.m_List2, 1));
+
+    QVERIFY(isInlineObject(&removedObject) && areDecimalNumbersEqual(*(double*)getObjectPayload(&removedObject), -2.5));
+    QVERIFY(isEmptyObject(&getListElementAtIndex(m_Fixture.m_List2, 1)->object));
+
+    deleteObjectPayload(&removedObject); // nothing to free
+
+    QVERIFY(isEmptyObject(&removedObject) && removedObject.type == -1 && !removedObject.payload);
+
+    clearList(m_Fixture.m_List1, emptyTestObject);
+    clearList(m_Fixture.m_List2, emptyTestObject);
+}
+
 void ListElementTests::initTestCase_data()
 {
     m_Fixture.init();
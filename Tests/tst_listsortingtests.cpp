@@ -4,6 +4,7 @@
 
 #include "listtestfixture.h"
 #include "sort.h"
+#include "testobjects.h"
 
 enum class SortingStatus
 {
@@ -38,6 +39,7 @@ private slots:
     void testIsSortedByPriority();
     void testMoveListToArray();
     void testMoveArrayToList();
+    void testRelayoutList();
 
     void testSortByPriorityNoRandomAccess_data();
     void testSortByPriorityUsingRandomAccess_data();
@@ -253,6 +255,51 @@ void ListSortingTests::testMoveArrayToList()
     QVERIFY(getListElementAtIndex(m_Fixture.m_List1, 1)->object.type == -1 && getListElementAtIndex(m_Fixture.m_List1, 1)->object.payload == nullptr);
 }
 
+void ListSortingTests::testRelayoutList()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    const Priority prioritiesArray[7]{6, 2, 5, 9, 1, 7, 3};
+
+    m_Fixture.m_List1 = createListFromPrioritiesArray(prioritiesArray, 7, pool);
+    QVERIFY(getListSize(m_Fixture.m_List1) == 7);
+
+    ListElement* element = getListElementAtIndex(m_Fixture.m_List1, 3);
+    assignObjectContentToListElement(element, INTEGER, createIntegerPayload(-4));
+
+    sortDescendingByPriority(m_Fixture.m_List1);
+
+    const bool relayoutDone = relayoutList(m_Fixture.m_List1);
+    QVERIFY(relayoutDone);
+
+    const Priority expectedPrioritiesArray[7]{9, 7, 6, 5, 3, 2, 1};
+    size_t index = 0;
+
+    for (ListIterator it = lbegin(m_Fixture.m_List1); !areIteratorsEqual(it, lend(m_Fixture.m_List1)); lnext(&it))
+    {
+        QVERIFY(index < 7 && it.current->priority == expectedPrioritiesArray[index]);
+        QVERIFY(!it.current->next || it.current < it.current->next);
+
+        if (index == 0)
+        {
+            QVERIFY(it.current->object.type == INTEGER && *static_cast<int*>(it.current->object.payload) == -4);
+        }
+        else
+        {
+            QVERIFY(it.current->object.type == -1 && it.current->object.payload == nullptr);
+        }
+
+        ++index;
+    }
+
+    QVERIFY(index == 7);
+    QVERIFY(getLastListElement(m_Fixture.m_List1)->priority == 1 && !getLastListElement(m_Fixture.m_List1)->next);
+
+    m_Fixture.m_List2 = createEmptyList(pool);
+    QVERIFY(!relayoutList(m_Fixture.m_List2));
+}
+
 void ListSortingTests::testSortByPriorityNoRandomAccess_data()
 {
     QTest::addColumn<Priorities>("priorities");
@@ -1,6 +1,7 @@
 // clang-format off
 #include <QTest>
 
+#include "linkedlist.h"
 #include "listtestfixture.h"
 #include "priorityqueue.h"
 #include "testobjects.h"
@@ -24,6 +25,7 @@ private slots:
     void testClearPriorityQueue();
     void testIterators();
     void testModifyObject();
+    void testRemovedElementsAreRecycled();
 
     void initTestCase_data();
     void cleanupTestCase();
@@ -258,6 +260,41 @@ void PriorityQueueTests::testModifyObject()
     removedObject = nullptr;
 }
 
+void PriorityQueueTests::testRemovedElementsAreRecycled()
+{
+    QFETCH_GLOBAL(ListElementsPool*, pool);
+    QVERIFY(!pool || pool == m_Fixture.m_Pool);
+
+    m_Queue1 = createPriorityQueue(pool);
+    const List* queueContainer = static_cast<const List*>(m_Queue1->container);
+    const size_t initialAquiredPoolElementsCount = pool ? getAquiredElementsCount(pool) : 0;
+    const size_t elementsCount{8};
+
+    // high churn: the removed elements are cached and re-used by the next insertions (no allocator round trip)
+    for (size_t round = 0; round < 100; ++round)
+    {
+        for (size_t index = 0; index < elementsCount; ++index)
+        {
+            insertIntoPriorityQueue(m_Queue1, index, INTEGER, createIntegerPayload(static_cast<int>(index)));
+        }
+
+        QVERIFY(getListSize(queueContainer) == elementsCount && getListRecycledElementsCount(queueContainer) == 0);
+        QVERIFY(!pool || getAquiredElementsCount(pool) == initialAquiredPoolElementsCount + elementsCount);
+
+        for (size_t index = 0; index < elementsCount; ++index)
+        {
+            Object* removedObject = removeFromPriorityQueue(m_Queue1);
+            QVERIFY(removedObject && removedObject->type == INTEGER);
+
+            deleteObject(removedObject, emptyTestObject);
+            removedObject = nullptr;
+        }
+
+        QVERIFY(isEmptyQueue(m_Queue1) && getListRecycledElementsCount(queueContainer) == elementsCount);
+        QVERIFY(!pool || getAquiredElementsCount(pool) == initialAquiredPoolElementsCount + elementsCount);
+    }
+}
+
 void PriorityQueueTests::initTestCase_data()
 {
     m_Fixture.init();
@@ -6,6 +6,12 @@
 #include "codeutils.h"
 #include "error.h"
 
+// "private" (supporting) functions
+static void _multiply128(uint64_t* first, uint64_t* second); // low and high product halves stored into first/second
+static uint64_t _mix(uint64_t first, uint64_t second);
+static uint64_t _read64(const unsigned char* data);
+static uint64_t _read32(const unsigned char* data);
+
 Object* createObject(int type, void* payload)
 {
     Object* result = NULL;
@@ -32,6 +38,55 @@ void deleteObject(Object* object, void (*emptyObject)(Object* object))
     object = NULL;
 }
 
+bool setInlineObjectPayload(Object* object, int type, const void* payloadData, size_t payloadSize)
+{
+    bool success = false;
+
+    if (object != NULL && payloadData != NULL && payloadSize > 0 && payloadSize <= OBJECT_INLINE_PAYLOAD_SIZE &&
+        type >= 0 && type < INLINE_OBJECT_FLAG)
+    {
+        ASSERT(object->type < 0, "Attempt to assign inline payload without emptying the existing object first!");
+
+        setNChars((char*)object->inlinePayload, '\0', OBJECT_INLINE_PAYLOAD_SIZE);
+        memcpy(object->inlinePayload, payloadData, payloadSize);
+        object->type = type | INLINE_OBJECT_FLAG;
+        success = true;
+    }
+
+    return success;
+}
+
+bool isInlineObject(const Object* object)
+{
+    return object != NULL && object->type >= 0 && (object->type & INLINE_OBJECT_FLAG) != 0;
+}
+
+bool isEmptyObject(const Object* object)
+{
+    return object == NULL || object->type < 0 || (!isInlineObject(object) && object->payload == NULL);
+}
+
+int getObjectType(const Object* object)
+{
+    return object != NULL && object->type >= 0 ? object->type & ~INLINE_OBJECT_FLAG : -1;
+}
+
+void* getObjectPayload(const Object* object)
+{
+    void* payload = NULL;
+
+    if (isInlineObject(object))
+    {
+        payload = (void*)object->inlinePayload;
+    }
+    else if (object != NULL)
+    {
+        payload = object->payload;
+    }
+
+    return payload;
+}
+
 void setNChars(char* start, char value, size_t count)
 {
     if (start != NULL && count > 0)
@@ -270,6 +325,70 @@ bool areDecimalNumbersEqual(double first, double second)
     return (fabs(first - second) < epsilon);
 }
 
+uint64_t computeHash(const void* data, size_t size)
+{
+    static const uint64_t secret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull,
+                                       0x589965cc75374cc3ull};
+
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t seed = _mix(secret[0], secret[1]);
+    uint64_t first = 0;
+    uint64_t second = 0;
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            const size_t middleOffset = (size >> 3) << 2;
+            first = (_read32(bytes) << 32) | _read32(bytes + middleOffset);
+            second = (_read32(bytes + size - 4) << 32) | _read32(bytes + size - 4 - middleOffset);
+        }
+        else if (size > 0)
+        {
+            first = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[size >> 1] << 8) | bytes[size - 1];
+        }
+    }
+    else
+    {
+        size_t remainingSize = size;
+
+        // 48 bytes per iteration split across three independent lanes
+        if (remainingSize > 48)
+        {
+            uint64_t firstLaneSeed = seed;
+            uint64_t secondLaneSeed = seed;
+
+            do
+            {
+                seed = _mix(_read64(bytes) ^ secret[1], _read64(bytes + 8) ^ seed);
+                firstLaneSeed = _mix(_read64(bytes + 16) ^ secret[2], _read64(bytes + 24) ^ firstLaneSeed);
+                secondLaneSeed = _mix(_read64(bytes + 32) ^ secret[3], _read64(bytes + 40) ^ secondLaneSeed);
+                bytes += 48;
+                remainingSize -= 48;
+            } while (remainingSize > 48);
+
+            seed ^= firstLaneSeed ^ secondLaneSeed;
+        }
+
+        while (remainingSize > 16)
+        {
+            seed = _mix(_read64(bytes) ^ secret[1], _read64(bytes + 8) ^ seed);
+            bytes += 16;
+            remainingSize -= 16;
+        }
+
+        // last 16 bytes (might overlap the already hashed ones)
+        first = _read64(bytes + remainingSize - 16);
+        second = _read64(bytes + remainingSize - 8);
+    }
+
+    first ^= secret[1];
+    second ^= seed;
+    _multiply128(&first, &second);
+
+    return _mix(first ^ secret[0] ^ (uint64_t)size, second ^ secret[1]);
+}
+
 void clearScreen()
 {
 #if defined(UNIX_OS)
@@ -278,3 +397,53 @@ void clearScreen()
     system("cls"); // Windows
 #endif
 }
+
+static void _multiply128(uint64_t* first, uint64_t* second)
+{
+#ifdef __SIZEOF_INT128__
+    const __uint128_t product = (__uint128_t)*first * *second;
+    *first = (uint64_t)product;
+    *second = (uint64_t)(product >> 64);
+#else
+    const uint64_t firstHigh = *first >> 32;
+    const uint64_t firstLow = (uint32_t)*first;
+    const uint64_t secondHigh = *second >> 32;
+    const uint64_t secondLow = (uint32_t)*second;
+    const uint64_t highProduct = firstHigh * secondHigh;
+    const uint64_t middleProduct = firstHigh * secondLow;
+    const uint64_t otherMiddleProduct = firstLow * secondHigh;
+    const uint64_t lowProduct = firstLow * secondLow;
+    const uint64_t lowResult = lowProduct + (middleProduct << 32);
+    const uint64_t carry = lowResult < lowProduct;
+    const uint64_t finalLowResult = lowResult + (otherMiddleProduct << 32);
+    const uint64_t finalCarry = carry + (finalLowResult < lowResult);
+
+    *first = finalLowResult;
+    *second = highProduct + (middleProduct >> 32) + (otherMiddleProduct >> 32) + finalCarry;
+#endif
+}
+
+static uint64_t _mix(uint64_t first, uint64_t second)
+{
+    _multiply128(&first, &second);
+
+    return first ^ second;
+}
+
+// unaligned little endian reads
+static uint64_t _read64(const unsigned char* data)
+{
+    uint64_t result = 0;
+
+    for (size_t index = 0; index < 8; ++index)
+    {
+        result |= (uint64_t)data[index] << (8 * index);
+    }
+
+    return result;
+}
+
+static uint64_t _read32(const unsigned char* data)
+{
+    return (uint64_t)data[0] | ((uint64_t)data[1] << 8) | ((uint64_t)data[2] << 16) | ((uint64_t)data[3] << 24);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #define FREE(ptr)                                                                                                      \
@@ -22,10 +23,26 @@
 #define UNIX_OS
 #endif
 
+#define OBJECT_INLINE_PAYLOAD_SIZE 16
+#define INLINE_OBJECT_FLAG 0x40000000 // set within the type of the objects having an inline payload
+
+/* An object either points to a payload or (if small enough) stores it inline, which saves an allocation and a pointer
+   dereference on each access
+   - an empty object has a negative type (and a NULL payload)
+   - the inline payload is flagged within the (non-negative) object type, so getObjectType() should be used for
+   retrieving the actual type
+   - the payload should be accessed by using getObjectPayload(), which works for both object kinds
+   - an inline payload should not contain pointers to allocated memory (it is never deallocated)
+*/
 typedef struct
 {
     int type;
-    void* payload;
+    union
+    {
+        void* payload;
+        double inlineAlignment; // ensures the inline payload is suitably aligned for any small (primitive) type
+        unsigned char inlinePayload[OBJECT_INLINE_PAYLOAD_SIZE];
+    };
 } Object;
 
 #ifdef __cplusplus
@@ -35,6 +52,11 @@ extern "C"
 
     Object* createObject(int type, void* payload);
     void deleteObject(Object* object, void (*emptyObject)(Object* object));
+    bool setInlineObjectPayload(Object* object, int type, const void* payloadData, size_t payloadSize);
+    bool isInlineObject(const Object* object);
+    bool isEmptyObject(const Object* object);
+    int getObjectType(const Object* object);
+    void* getObjectPayload(const Object* object);
 
     // a replacement for memset which is considered insecure by C11 standard (to be used for strings)
     void setNChars(char* start, char value, size_t count);
@@ -49,6 +71,9 @@ extern "C"
     bool convertIntToString(int valueToConvert, char* str, size_t availableCharsCount);
     bool areDecimalNumbersEqual(double first, double second);
 
+    // fast non-cryptographic hash (wyhash algorithm), all output bits are well mixed so masking them is safe
+    uint64_t computeHash(const void* data, size_t size);
+
     void clearScreen();
 
 #ifdef __cplusplus
@@ -0,0 +1,171 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "codeutils.h"
+#include "error.h"
+#include "slaballocator.h"
+
+typedef struct Slab
+{
+    struct Slab* next;
+    size_t usedObjectsCount; // objects handed out from slab at least once (the rest have never been used)
+    max_align_t objects[];
+} Slab;
+
+typedef struct FreeSlabObject
+{
+    struct FreeSlabObject* next;
+} FreeSlabObject;
+
+typedef struct
+{
+    Slab* lastSlab; // newest slab, the only one that might contain never used objects
+    FreeSlabObject* freeObjects;
+    size_t objectSize;
+    size_t slabObjectsCount;
+    size_t allocatedObjectsCount;
+} SlabAllocatorContent;
+
+static Slab* createSlab(size_t objectSize, size_t slabObjectsCount);
+
+SlabAllocator* createSlabAllocator(size_t objectSize, size_t slabObjectsCount)
+{
+    SlabAllocator* slabAllocator = objectSize > 0 ? (SlabAllocator*)malloc(sizeof(SlabAllocator)) : NULL;
+    SlabAllocatorContent* slabContent =
+        slabAllocator != NULL ? (SlabAllocatorContent*)malloc(sizeof(SlabAllocatorContent)) : NULL;
+
+    if (slabContent != NULL)
+    {
+        // each object should be able to store the free list link and keep the alignment of the next object
+        const size_t minObjectSize = objectSize > sizeof(FreeSlabObject) ? objectSize : sizeof(FreeSlabObject);
+        const size_t alignment = _Alignof(max_align_t);
+
+        slabContent->lastSlab = NULL;
+        slabContent->freeObjects = NULL;
+        slabContent->objectSize = (minObjectSize + alignment - 1) / alignment * alignment;
+        slabContent->slabObjectsCount = slabObjectsCount > 0 ? slabObjectsCount : SLAB_DEFAULT_OBJECTS_COUNT;
+        slabContent->allocatedObjectsCount = 0;
+        slabAllocator->slabContent = slabContent;
+    }
+    else
+    {
+        FREE(slabAllocator);
+    }
+
+    return slabAllocator;
+}
+
+void deleteSlabAllocator(SlabAllocator* slabAllocator)
+{
+    SlabAllocatorContent* slabContent =
+        slabAllocator != NULL ? (SlabAllocatorContent*)slabAllocator->slabContent : NULL;
+
+    ASSERT(slabAllocator == NULL || slabContent != NULL, "Invalid slab allocator content!");
+
+    Slab* currentSlab = slabContent != NULL ? slabContent->lastSlab : NULL;
+
+    while (currentSlab != NULL)
+    {
+        Slab* slabToDelete = currentSlab;
+        currentSlab = currentSlab->next;
+        free(slabToDelete);
+    }
+
+    FREE(slabContent);
+    FREE(slabAllocator);
+}
+
+void* allocateSlabObject(SlabAllocator* slabAllocator)
+{
+    void* object = NULL;
+    SlabAllocatorContent* slabContent =
+        slabAllocator != NULL ? (SlabAllocatorContent*)slabAllocator->slabContent : NULL;
+
+    ASSERT(slabAllocator == NULL || slabContent != NULL, "Invalid slab allocator content!");
+
+    if (slabContent != NULL && slabContent->freeObjects != NULL)
+    {
+        object = slabContent->freeObjects;
+        slabContent->freeObjects = slabContent->freeObjects->next;
+    }
+    else if (slabContent != NULL)
+    {
+        Slab* lastSlab = slabContent->lastSlab;
+
+        if (lastSlab == NULL || lastSlab->usedObjectsCount == slabContent->slabObjectsCount)
+        {
+            Slab* newSlab = createSlab(slabContent->objectSize, slabContent->slabObjectsCount);
+
+            if (newSlab != NULL)
+            {
+                newSlab->next = lastSlab;
+                slabContent->lastSlab = newSlab;
+            }
+
+            lastSlab = newSlab;
+        }
+
+        if (lastSlab != NULL)
+        {
+            object = (char*)lastSlab->objects + lastSlab->usedObjectsCount * slabContent->objectSize;
+            ++lastSlab->usedObjectsCount;
+        }
+    }
+
+    if (object != NULL)
+    {
+        ++slabContent->allocatedObjectsCount;
+    }
+
+    return object;
+}
+
+// the object should have been allocated by the same slab allocator
+void freeSlabObject(SlabAllocator* slabAllocator, void* object)
+{
+    SlabAllocatorContent* slabContent =
+        slabAllocator != NULL ? (SlabAllocatorContent*)slabAllocator->slabContent : NULL;
+
+    ASSERT(slabAllocator == NULL || slabContent != NULL, "Invalid slab allocator content!");
+    ASSERT(object == NULL || slabContent == NULL || slabContent->allocatedObjectsCount > 0,
+           "Attempt to free an object that has not been allocated!");
+
+    if (slabContent != NULL && object != NULL && slabContent->allocatedObjectsCount > 0)
+    {
+        FreeSlabObject* freedObject = (FreeSlabObject*)object;
+        freedObject->next = slabContent->freeObjects;
+        slabContent->freeObjects = freedObject;
+        --slabContent->allocatedObjectsCount;
+    }
+}
+
+size_t getSlabAllocatedObjectsCount(SlabAllocator* slabAllocator)
+{
+    const SlabAllocatorContent* slabContent =
+        slabAllocator != NULL ? (SlabAllocatorContent*)slabAllocator->slabContent : NULL;
+
+    return slabContent != NULL ? slabContent->allocatedObjectsCount : 0;
+}
+
+size_t getSlabObjectSize(SlabAllocator* slabAllocator)
+{
+    const SlabAllocatorContent* slabContent =
+        slabAllocator != NULL ? (SlabAllocatorContent*)slabAllocator->slabContent : NULL;
+
+    return slabContent != NULL ? slabContent->objectSize : 0;
+}
+
+static Slab* createSlab(size_t objectSize, size_t slabObjectsCount)
+{
+    const bool isSlabSizeValid = slabObjectsCount <= (SIZE_MAX - sizeof(Slab)) / objectSize;
+    Slab* slab = isSlabSizeValid ? (Slab*)malloc(sizeof(Slab) + objectSize * slabObjectsCount) : NULL;
+
+    if (slab != NULL)
+    {
+        slab->next = NULL;
+        slab->usedObjectsCount = 0;
+    }
+
+    return slab;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define SLAB_DEFAULT_OBJECTS_COUNT 256
+
+/* The slab allocator hands out fixed size objects (e.g. payloads of a given type) carved from larger memory blocks
+   (slabs)
+   - freed objects are kept in a free list (their memory stores the link) and get re-used first
+   - a new slab is allocated only if no freed object is available and the last slab is exhausted
+   - the slabs are only released when the allocator gets deleted (all objects become invalid)
+   - each object is aligned for storing any fundamental type
+*/
+typedef struct
+{
+    void* slabContent;
+} SlabAllocator;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // 0 objects count: SLAB_DEFAULT_OBJECTS_COUNT objects per slab
+    SlabAllocator* createSlabAllocator(size_t objectSize, size_t slabObjectsCount);
+    void deleteSlabAllocator(SlabAllocator* slabAllocator);
+    void* allocateSlabObject(SlabAllocator* slabAllocator);
+    void freeSlabObject(SlabAllocator* slabAllocator, void* object);
+    size_t getSlabAllocatedObjectsCount(SlabAllocator* slabAllocator);
+    size_t getSlabObjectSize(SlabAllocator* slabAllocator);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,8 +1,16 @@
 #include "testobjects.h"
 #include "error.h"
+#include "slaballocator.h"
 
 #include <stdio.h>
 
+#define TEST_OBJECT_TYPES_COUNT 5
+
+static SlabAllocator* payloadSlabs[TEST_OBJECT_TYPES_COUNT] = {NULL};
+
+static void* allocateSlabPayload(int type);
+static size_t getPayloadSize(int type);
+
 int* createIntegerPayload(int value)
 {
     int* integer = (int*)malloc(sizeof(int));
@@ -80,7 +88,13 @@ LocalConditions* createLocalConditionsPayload(int positionX, int positionY, int
 
 void emptyTestObject(Object* object)
 {
-    if (object != NULL && object->payload != NULL)
+    if (isInlineObject(object))
+    {
+        // inline payloads (integer, decimal, point) own no memory
+        object->type = -1;
+        object->payload = NULL;
+    }
+    else if (object != NULL && object->payload != NULL)
     {
         switch (object->type)
         {
@@ -129,3 +143,169 @@ const char* getTestObjectTypeAsString(int type)
 
     return result;
 }
+
+int* createSlabIntegerPayload(int value)
+{
+    int* integer = (int*)allocateSlabPayload(INTEGER);
+
+    if (integer != NULL)
+    {
+        *integer = value;
+    }
+
+    return integer;
+}
+
+double* createSlabDecimalPayload(double value)
+{
+    double* decimal = (double*)allocateSlabPayload(DECIMAL);
+
+    if (decimal != NULL)
+    {
+        *decimal = value;
+    }
+
+    return decimal;
+}
+
+Point* createSlabPointPayload(int x, int y)
+{
+    Point* point = (Point*)allocateSlabPayload(POINT);
+
+    if (point != NULL)
+    {
+        point->x = x;
+        point->y = y;
+    }
+
+    return point;
+}
+
+Segment* createSlabSegmentPayload(int startX, int startY, int stopX, int stopY)
+{
+    Segment* segment = (Segment*)allocateSlabPayload(SEGMENT);
+
+    if (segment != NULL)
+    {
+        segment->start.x = startX;
+        segment->start.y = startY;
+        segment->stop.x = stopX;
+        segment->stop.y = stopY;
+    }
+
+    return segment;
+}
+
+LocalConditions* createSlabLocalConditionsPayload(int positionX, int positionY, int temperature, double humidity)
+{
+    LocalConditions* conditions = NULL;
+
+    const double minHumidity = 0.0;
+    const double maxHumidity = 100.0;
+
+    if (humidity >= minHumidity && humidity <= maxHumidity)
+    {
+        conditions = (LocalConditions*)allocateSlabPayload(LOCAL_CONDITIONS);
+
+        if (conditions != NULL)
+        {
+            conditions->position.x = positionX;
+            conditions->position.y = positionY;
+            conditions->temperature = temperature;
+            conditions->humidity = humidity;
+        }
+    }
+
+    return conditions;
+}
+
+void deleteSlabTestObjectPayload(Object* object)
+{
+    if (isInlineObject(object))
+    {
+        object->type = -1;
+        object->payload = NULL;
+    }
+    else if (object != NULL && object->payload != NULL)
+    {
+        const bool isValidType = object->type >= 0 && object->type < TEST_OBJECT_TYPES_COUNT;
+        ASSERT(isValidType && payloadSlabs[object->type] != NULL, "Invalid slab test object type!");
+
+        if (isValidType)
+        {
+            freeSlabObject(payloadSlabs[object->type], object->payload);
+        }
+
+        object->type = -1;
+        object->payload = NULL;
+    }
+}
+
+size_t getSlabTestPayloadsCount()
+{
+    size_t payloadsCount = 0;
+
+    for (size_t typeIndex = 0; typeIndex < TEST_OBJECT_TYPES_COUNT; ++typeIndex)
+    {
+        payloadsCount += getSlabAllocatedObjectsCount(payloadSlabs[typeIndex]);
+    }
+
+    return payloadsCount;
+}
+
+void deleteTestPayloadSlabs()
+{
+    for (size_t typeIndex = 0; typeIndex < TEST_OBJECT_TYPES_COUNT; ++typeIndex)
+    {
+        ASSERT(getSlabAllocatedObjectsCount(payloadSlabs[typeIndex]) == 0, "Slab payloads still in use!");
+        deleteSlabAllocator(payloadSlabs[typeIndex]);
+        payloadSlabs[typeIndex] = NULL;
+    }
+}
+
+// the slab of each payload type is created on first use
+static void* allocateSlabPayload(int type)
+{
+    void* payload = NULL;
+    const size_t payloadSize = getPayloadSize(type);
+
+    if (payloadSize > 0)
+    {
+        if (payloadSlabs[type] == NULL)
+        {
+            payloadSlabs[type] = createSlabAllocator(payloadSize, SLAB_DEFAULT_OBJECTS_COUNT);
+        }
+
+        payload = allocateSlabObject(payloadSlabs[type]);
+    }
+
+    return payload;
+}
+
+static size_t getPayloadSize(int type)
+{
+    size_t payloadSize = 0;
+
+    switch (type)
+    {
+    case INTEGER:
+        payloadSize = sizeof(int);
+        break;
+    case DECIMAL:
+        payloadSize = sizeof(double);
+        break;
+    case POINT:
+        payloadSize = sizeof(Point);
+        break;
+    case SEGMENT:
+        payloadSize = sizeof(Segment);
+        break;
+    case LOCAL_CONDITIONS:
+        payloadSize = sizeof(LocalConditions);
+        break;
+    default:
+        ASSERT(false, "Invalid test object type!");
+    }
+
+    return payloadSize;
+}
@@ -43,6 +43,21 @@ extern "C"
 
     void emptyTestObject(Object* object);
 
+    /* Slab allocated payloads: one slab allocator per payload type, created on first use
+       - the payloads should be deleted by using deleteSlabTestObjectPayload() (e.g. as clearList() deallocator)
+       - the slabs are static (shared by all callers) and not thread safe: payloads should not be created/deleted
+       concurrently from multiple threads
+       - the slabs should be deleted (deleteTestPayloadSlabs()) once no payloads are in use anymore
+    */
+    int* createSlabIntegerPayload(int value);
+    double* createSlabDecimalPayload(double value);
+    Point* createSlabPointPayload(int x, int y);
+    Segment* createSlabSegmentPayload(int startX, int startY, int stopX, int stopY);
+    LocalConditions* createSlabLocalConditionsPayload(int positionX, int positionY, int temperature, double humidity);
+    void deleteSlabTestObjectPayload(Object* object);
+    size_t getSlabTestPayloadsCount();
+    void deleteTestPayloadSlabs();
+
     const char* getTestObjectTypeAsString(int type);
 
 #ifdef __cplusplus